@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storage/column_batch.hpp"
+#include "storage/table.hpp"
+#include "storage/table_writer.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Measures how the ingestion throughput scales with the number of threads, for Table::append, which serializes all
+// appends, for Table::append_columns with batches of typed columns, and for one TableWriter per thread.
+// Usage: opossumIngestionBenchmark [row_count] [max_thread_count]
+
+namespace {
+
+constexpr auto CHUNK_SIZE = ChunkOffset{65'535};
+
+std::shared_ptr<Table> create_table() {
+  auto table = std::make_shared<Table>(CHUNK_SIZE);
+  table->add_column("id", "long", false);
+  table->add_column("tenant", "int", false);
+  table->add_column("price", "double", true);
+  table->add_column("comment", "string", false);
+  return table;
+}
+
+std::vector<AllTypeVariant> create_row(const uint64_t row_index) {
+  return {static_cast<int64_t>(row_index), static_cast<int32_t>(row_index % 97),
+          row_index % 10 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{static_cast<double>(row_index) * 0.25},
+          "comment " + std::to_string(row_index % 1000)};
+}
+
+// Returns the rows per second when thread_count threads insert row_count rows with the given function.
+template <typename InsertRows>
+double measure(const uint64_t row_count, const size_t thread_count, const InsertRows& insert_rows) {
+  const auto table = create_table();
+  const auto begin = std::chrono::steady_clock::now();
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = size_t{0}; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      insert_rows(*table, thread_index * row_count / thread_count, (thread_index + 1) * row_count / thread_count);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+  Assert(table->row_count() == row_count, "Not all rows were inserted.");
+  return static_cast<double>(row_count) / seconds;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto row_count = argc > 1 ? std::stoull(argv[1]) : uint64_t{2'000'000};
+  const auto max_thread_count = argc > 2 ? std::stoul(argv[2]) : size_t{16};
+
+  const auto append_rows = [](Table& table, const uint64_t begin, const uint64_t end) {
+    for (auto row_index = begin; row_index < end; ++row_index) {
+      table.append(create_row(row_index));
+    }
+  };
+  const auto append_columns = [](Table& table, const uint64_t begin, const uint64_t end) {
+    auto ids = std::vector<int64_t>{};
+    auto tenants = std::vector<int32_t>{};
+    auto prices = std::vector<double>{};
+    auto price_null_values = Bitmap{};
+    auto comments = std::vector<std::string>{};
+    for (auto batch_begin = begin; batch_begin < end; batch_begin += CHUNK_SIZE) {
+      const auto batch_end = std::min(end, batch_begin + CHUNK_SIZE);
+      ids.clear();
+      tenants.clear();
+      prices.clear();
+      price_null_values.resize(0);
+      comments.clear();
+      for (auto row_index = batch_begin; row_index < batch_end; ++row_index) {
+        ids.emplace_back(static_cast<int64_t>(row_index));
+        tenants.emplace_back(static_cast<int32_t>(row_index % 97));
+        prices.emplace_back(row_index % 10 == 0 ? 0.0 : static_cast<double>(row_index) * 0.25);
+        price_null_values.push_back(row_index % 10 == 0);
+        comments.emplace_back("comment " + std::to_string(row_index % 1000));
+      }
+      table.append_columns({std::make_shared<ColumnBatch<int64_t>>(ids),
+                            std::make_shared<ColumnBatch<int32_t>>(tenants),
+                            std::make_shared<ColumnBatch<double>>(prices, &price_null_values),
+                            std::make_shared<ColumnBatch<std::string>>(comments)});
+    }
+  };
+  const auto write_rows = [](Table& table, const uint64_t begin, const uint64_t end) {
+    auto writer = TableWriter{table};
+    for (auto row_index = begin; row_index < end; ++row_index) {
+      writer.append(create_row(row_index));
+    }
+  };
+
+  std::cout << "Inserting " << row_count << " rows (" << std::thread::hardware_concurrency() << " hardware threads)\n";
+  std::cout << std::setw(8) << "threads" << std::setw(20) << "Table::append" << std::setw(20) << "append_columns"
+            << std::setw(20) << "TableWriter" << std::setw(10) << "speedup" << "\n";
+  auto single_writer_throughput = 0.0;
+  for (auto thread_count = size_t{1}; thread_count <= max_thread_count; thread_count *= 2) {
+    const auto append_throughput = measure(row_count, thread_count, append_rows);
+    const auto append_columns_throughput = measure(row_count, thread_count, append_columns);
+    const auto writer_throughput = measure(row_count, thread_count, write_rows);
+    if (thread_count == 1) {
+      single_writer_throughput = writer_throughput;
+    }
+    std::cout << std::setw(8) << thread_count << std::setw(14) << static_cast<uint64_t>(append_throughput) << " rows/s"
+              << std::setw(14) << static_cast<uint64_t>(append_columns_throughput) << " rows/s" << std::setw(14)
+              << static_cast<uint64_t>(writer_throughput) << " rows/s" << std::setw(9)
+              << std::fixed << std::setprecision(2) << writer_throughput / single_writer_throughput << "x\n";
+  }
+
+  return 0;
+}
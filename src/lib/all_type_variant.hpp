@@ -14,6 +14,8 @@
 #include <boost/preprocessor/seq/for_each.hpp>
 #include <boost/preprocessor/seq/transform.hpp>
 
+#include "date_time.hpp"
+#include "decimal.hpp"
 #include "null_value.hpp"
 #include "types.hpp"
 
@@ -25,9 +27,13 @@ namespace detail {
 
 #define EXPAND_TO_HANA_TYPE(s, data, elem) boost::hana::type_c<elem>
 
+// int8_t and int16_t are named after their Java counterparts, like int32_t and int64_t. Date, Timestamp, and Decimal
+// are stored as integers (see date_time.hpp and decimal.hpp).
 // clang-format off
-#define data_types_macro                              (int32_t) (int64_t) (float)  (double)  (std::string)    // NOLINT
-static constexpr auto type_strings = hana::make_tuple("int",    "long",   "float", "double", "string"     );  // NOLINT
+#define data_types_macro \
+  (int32_t) (int64_t) (float)  (double)  (std::string) (int8_t) (int16_t) (Date)  (Timestamp)  (Decimal)     // NOLINT
+static constexpr auto type_strings = hana::make_tuple(                                                       // NOLINT
+  "int",    "long",   "float", "double", "string",     "byte",  "short",  "date", "timestamp", "decimal");   // NOLINT
 // clang-format on
 
 // Extends to hana::make_tuple(hana::type_c<int32_t>, hana::type_c<int64_t>, ...);
@@ -0,0 +1,110 @@
+#include "transaction_context.hpp"
+
+#include "storage/mvcc_data.hpp"
+#include "transaction_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
+    : _transaction_id{transaction_id}, _snapshot_commit_id{snapshot_commit_id} {}
+
+TransactionContext::~TransactionContext() {
+  if (_phase == TransactionPhase::Active) {
+    rollback();
+  }
+}
+
+TransactionID TransactionContext::transaction_id() const {
+  return _transaction_id;
+}
+
+CommitID TransactionContext::snapshot_commit_id() const {
+  return _snapshot_commit_id;
+}
+
+std::optional<CommitID> TransactionContext::commit_id() const {
+  return _commit_id;
+}
+
+TransactionPhase TransactionContext::phase() const {
+  return _phase;
+}
+
+bool TransactionContext::is_visible(const MvccData& mvcc_data, const ChunkOffset chunk_offset) const {
+  return mvcc_data.is_visible(chunk_offset, _transaction_id, _snapshot_commit_id);
+}
+
+void TransactionContext::register_insert(const std::shared_ptr<MvccData>& mvcc_data, const ChunkOffset chunk_offset) {
+  Assert(_phase == TransactionPhase::Active, "Tried to insert into a finished transaction.");
+  DebugAssert(mvcc_data->transaction_id(chunk_offset) == _transaction_id &&
+                  mvcc_data->begin_commit_id(chunk_offset) == MAX_COMMIT_ID,
+              "Inserted row has to be held by the transaction and must not be committed.");
+  _inserted_rows.push_back({mvcc_data, chunk_offset});
+}
+
+bool TransactionContext::try_delete(const std::shared_ptr<MvccData>& mvcc_data, const ChunkOffset chunk_offset) {
+  Assert(_phase == TransactionPhase::Active, "Tried to delete in a finished transaction.");
+  const auto is_held = mvcc_data->transaction_id(chunk_offset) == _transaction_id;
+  if (is_held && (mvcc_data->begin_commit_id(chunk_offset) != MAX_COMMIT_ID ||
+                  mvcc_data->end_commit_id(chunk_offset) != MAX_COMMIT_ID)) {
+    // The transaction already deleted the row.
+    return true;
+  }
+  if (!is_visible(*mvcc_data, chunk_offset)) {
+    _has_conflict = true;
+    return false;
+  }
+
+  if (is_held) {
+    // A row that the transaction inserted itself is hidden from the transaction by an end commit id that is smaller
+    // than any snapshot. It remains invisible to others because it is not committed.
+    mvcc_data->set_end_commit_id(chunk_offset, 0);
+  } else {
+    auto expected_transaction_id = INVALID_TRANSACTION_ID;
+    if (!mvcc_data->compare_exchange_transaction_id(chunk_offset, expected_transaction_id, _transaction_id)) {
+      _has_conflict = true;
+      return false;
+    }
+  }
+  _deleted_rows.push_back({mvcc_data, chunk_offset});
+  return true;
+}
+
+bool TransactionContext::has_conflict() const {
+  return _has_conflict;
+}
+
+void TransactionContext::commit() {
+  Assert(_phase == TransactionPhase::Active, "Tried to commit a finished transaction.");
+  Assert(!_has_conflict, "Tried to commit a transaction with a write-write conflict.");
+  _commit_id = TransactionManager::get().commit([&](const CommitID commit_id) {
+    for (const auto& [mvcc_data, chunk_offset] : _inserted_rows) {
+      mvcc_data->set_begin_commit_id(chunk_offset, commit_id);
+      mvcc_data->set_transaction_id(chunk_offset, INVALID_TRANSACTION_ID);
+    }
+    // Deleted rows stay held by the transaction, so that they cannot be deleted again.
+    for (const auto& [mvcc_data, chunk_offset] : _deleted_rows) {
+      mvcc_data->set_end_commit_id(chunk_offset, commit_id);
+      mvcc_data->invalidate(chunk_offset);
+    }
+  });
+  _phase = TransactionPhase::Committed;
+  TransactionManager::get()._finish_transaction(_snapshot_commit_id);
+}
+
+void TransactionContext::rollback() {
+  Assert(_phase == TransactionPhase::Active, "Tried to roll back a finished transaction.");
+  for (const auto& [mvcc_data, chunk_offset] : _deleted_rows) {
+    mvcc_data->set_transaction_id(chunk_offset, INVALID_TRANSACTION_ID);
+  }
+  // Inserted rows are released, but never committed. Thus, they remain invisible to all transactions.
+  for (const auto& [mvcc_data, chunk_offset] : _inserted_rows) {
+    mvcc_data->set_transaction_id(chunk_offset, INVALID_TRANSACTION_ID);
+    mvcc_data->invalidate(chunk_offset);
+  }
+  _phase = TransactionPhase::RolledBack;
+  TransactionManager::get()._finish_transaction(_snapshot_commit_id);
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class MvccData;
+
+enum class TransactionPhase { Active, Committed, RolledBack };
+
+// A transaction context holds the state of a transaction: its id, the snapshot that it reads, and the rows that it
+// inserted or deleted. Inserted rows are only visible to the transaction itself until it commits. Deleted rows are
+// held by the transaction, so that no other transaction can delete them, and remain visible to others until it
+// commits. Operators that are given a
+// transaction context (see AbstractOperator::set_transaction_context) only see the rows that are visible to it.
+// Contexts are only created by the TransactionManager, which registers their snapshot as active. An active
+// transaction is rolled back when its context is destroyed.
+class TransactionContext : private Noncopyable {
+  friend class TransactionManager;
+
+ public:
+  ~TransactionContext();
+
+  TransactionID transaction_id() const;
+
+  // Returns the commit id of the snapshot that the transaction reads.
+  CommitID snapshot_commit_id() const;
+
+  // Returns the commit id of the transaction once it has committed.
+  std::optional<CommitID> commit_id() const;
+
+  TransactionPhase phase() const;
+
+  // Returns whether the row is visible to the transaction.
+  bool is_visible(const MvccData& mvcc_data, const ChunkOffset chunk_offset) const;
+
+  // Records a row that the transaction inserted, which has to be held by the transaction and not yet be committed.
+  void register_insert(const std::shared_ptr<MvccData>& mvcc_data, const ChunkOffset chunk_offset);
+
+  // Deletes a row that is visible to the transaction. Returns false if the row is not visible (anymore) or held by
+  // another transaction, i.e., on a write-write conflict. A transaction with a conflict cannot commit and has to be
+  // rolled back.
+  bool try_delete(const std::shared_ptr<MvccData>& mvcc_data, const ChunkOffset chunk_offset);
+
+  // Returns whether a delete of the transaction failed.
+  bool has_conflict() const;
+
+  // Makes the changes of the transaction visible to transactions that start afterwards.
+  void commit();
+
+  // Discards the changes of the transaction.
+  void rollback();
+
+ protected:
+  TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id);
+
+  struct RowReference {
+    std::shared_ptr<MvccData> mvcc_data;
+    ChunkOffset chunk_offset;
+  };
+
+  const TransactionID _transaction_id;
+  const CommitID _snapshot_commit_id;
+  std::optional<CommitID> _commit_id;
+  TransactionPhase _phase{TransactionPhase::Active};
+  bool _has_conflict{false};
+  std::vector<RowReference> _inserted_rows;
+  std::vector<RowReference> _deleted_rows;
+};
+
+}  // namespace opossum
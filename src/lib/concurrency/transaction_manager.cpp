@@ -0,0 +1,48 @@
+#include "transaction_manager.hpp"
+
+#include "transaction_context.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TransactionManager& TransactionManager::get() {
+  static TransactionManager instance;
+  return instance;
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
+  const auto lock = std::lock_guard{_active_snapshots_mutex};
+  const auto snapshot_commit_id = last_commit_id();
+  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+  // The constructor is not accessible to std::make_shared.
+  return std::shared_ptr<TransactionContext>(new TransactionContext(_next_transaction_id++, snapshot_commit_id));
+}
+
+CommitID TransactionManager::last_commit_id() const {
+  // Synchronizes with the release store in commit, so that the rows of all commits up to the snapshot are visible.
+  return _last_commit_id.load(std::memory_order_acquire);
+}
+
+CommitID TransactionManager::lowest_active_snapshot_commit_id() const {
+  const auto lock = std::lock_guard{_active_snapshots_mutex};
+  return _active_snapshot_commit_ids.empty() ? last_commit_id() : *_active_snapshot_commit_ids.begin();
+}
+
+void TransactionManager::_finish_transaction(const CommitID snapshot_commit_id) {
+  const auto lock = std::lock_guard{_active_snapshots_mutex};
+  // Only one registration is removed, as other transactions might read the same snapshot.
+  const auto iterator = _active_snapshot_commit_ids.find(snapshot_commit_id);
+  Assert(iterator != _active_snapshot_commit_ids.end(), "Finished a transaction that was not registered.");
+  _active_snapshot_commit_ids.erase(iterator);
+}
+
+CommitID TransactionManager::commit(const std::function<void(CommitID)>& apply_commit) {
+  const auto lock = std::lock_guard{_commit_mutex};
+  const auto commit_id = _last_commit_id.load(std::memory_order_relaxed) + 1;
+  Assert(commit_id != MAX_COMMIT_ID, "Ran out of commit ids.");
+  apply_commit(commit_id);
+  _last_commit_id.store(commit_id, std::memory_order_release);
+  return commit_id;
+}
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class TransactionContext;
+
+// The TransactionManager is a singleton that hands out transaction ids and snapshots and orders commits. A snapshot is
+// the id of the last commit, i.e., it contains all rows that were committed at or before it. Commits are serialized,
+// and a commit id is only handed out as a snapshot once all rows of the commit carry it.
+class TransactionManager : private Noncopyable {
+  friend class TransactionContext;
+
+ public:
+  static TransactionManager& get();
+
+  // Starts a new transaction that reads the current snapshot.
+  std::shared_ptr<TransactionContext> new_transaction_context();
+
+  // Returns the id of the last completed commit.
+  CommitID last_commit_id() const;
+
+  // Returns the oldest snapshot that an active transaction reads or the last commit id if there is no active
+  // transaction. Rows that were deleted at or before it are not visible to any transaction anymore.
+  CommitID lowest_active_snapshot_commit_id() const;
+
+  // Assigns the next commit id, lets apply_commit set it as begin or end commit id of the committed rows, and then
+  // publishes it. Used by TransactionContext::commit and by appends outside of transactions, which are committed
+  // right away.
+  CommitID commit(const std::function<void(CommitID)>& apply_commit);
+
+  TransactionManager(TransactionManager&&) = delete;
+
+ protected:
+  TransactionManager() = default;
+
+  // Called when a transaction commits or is rolled back.
+  void _finish_transaction(const CommitID snapshot_commit_id);
+
+  std::atomic<TransactionID> _next_transaction_id{INVALID_TRANSACTION_ID + 1};
+  std::atomic<CommitID> _last_commit_id{0};
+  std::mutex _commit_mutex;
+
+  std::multiset<CommitID> _active_snapshot_commit_ids;
+  mutable std::mutex _active_snapshots_mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,210 @@
+#include "date_time.hpp"
+
+#include <cctype>
+#include <charconv>
+#include <iomanip>
+#include <optional>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Parses exactly `digits` decimal digits at `position` and advances it. Returns std::nullopt if there are fewer
+// digits.
+std::optional<int64_t> parse_digits(const std::string_view string, size_t& position, const size_t digits) {
+  if (string.size() < position + digits) {
+    return std::nullopt;
+  }
+  auto value = int64_t{0};
+  const auto* const begin = string.data() + position;
+  const auto [end, error] = std::from_chars(begin, begin + digits, value);
+  if (error != std::errc{} || end != begin + digits) {
+    return std::nullopt;
+  }
+  position += digits;
+  return value;
+}
+
+bool consume(const std::string_view string, size_t& position, const char expected) {
+  if (position >= string.size() || string[position] != expected) {
+    return false;
+  }
+  ++position;
+  return true;
+}
+
+std::optional<Date> try_parse_date(const std::string_view string, size_t& position) {
+  const auto year = parse_digits(string, position, 4);
+  if (!year || !consume(string, position, '-')) {
+    return std::nullopt;
+  }
+  const auto month = parse_digits(string, position, 2);
+  if (!month || !consume(string, position, '-')) {
+    return std::nullopt;
+  }
+  const auto day = parse_digits(string, position, 2);
+  if (!day) {
+    return std::nullopt;
+  }
+
+  const auto year_month_day = std::chrono::year_month_day{std::chrono::year{static_cast<int32_t>(*year)},
+                                                          std::chrono::month{static_cast<uint32_t>(*month)},
+                                                          std::chrono::day{static_cast<uint32_t>(*day)}};
+  if (!year_month_day.ok()) {
+    return std::nullopt;
+  }
+  return Date{static_cast<int32_t>(std::chrono::sys_days{year_month_day}.time_since_epoch().count())};
+}
+
+std::optional<Timestamp> try_parse_timestamp(const std::string_view string) {
+  auto position = size_t{0};
+  const auto date = try_parse_date(string, position);
+  if (!date) {
+    return std::nullopt;
+  }
+  auto microseconds = int64_t{Timestamp{*date}.microseconds_since_epoch()};
+  if (position == string.size()) {
+    return Timestamp{microseconds};
+  }
+
+  if (!consume(string, position, ' ')) {
+    return std::nullopt;
+  }
+  const auto hours = parse_digits(string, position, 2);
+  if (!hours || *hours > 23 || !consume(string, position, ':')) {
+    return std::nullopt;
+  }
+  const auto minutes = parse_digits(string, position, 2);
+  if (!minutes || *minutes > 59 || !consume(string, position, ':')) {
+    return std::nullopt;
+  }
+  const auto seconds = parse_digits(string, position, 2);
+  if (!seconds || *seconds > 59) {
+    return std::nullopt;
+  }
+  microseconds += ((*hours * 60 + *minutes) * 60 + *seconds) * 1'000'000;
+
+  // Up to six fractional digits, e.g., ".5" means 500'000 microseconds.
+  if (consume(string, position, '.')) {
+    const auto fraction_begin = position;
+    auto fraction = int64_t{0};
+    while (position < string.size() && position - fraction_begin < 6 && std::isdigit(string[position])) {
+      fraction = fraction * 10 + (string[position] - '0');
+      ++position;
+    }
+    if (position == fraction_begin) {
+      return std::nullopt;
+    }
+    for (auto digit = position - fraction_begin; digit < 6; ++digit) {
+      fraction *= 10;
+    }
+    microseconds += fraction;
+  }
+
+  if (position != string.size()) {
+    return std::nullopt;
+  }
+  return Timestamp{microseconds};
+}
+
+// Reads the next whitespace-delimited token. Timestamps consist of two tokens if they contain a time.
+std::string read_token(std::istream& stream) {
+  auto token = std::string{};
+  stream >> token;
+  return token;
+}
+
+}  // namespace
+
+Date Date::from_year_month_day(const int32_t year, const uint32_t month, const uint32_t day) {
+  const auto year_month_day =
+      std::chrono::year_month_day{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+  Assert(year_month_day.ok(), "Tried to create an invalid date.");
+  return Date{static_cast<int32_t>(std::chrono::sys_days{year_month_day}.time_since_epoch().count())};
+}
+
+Date Date::parse(const std::string_view string) {
+  auto position = size_t{0};
+  const auto date = try_parse_date(string, position);
+  Assert(date && position == string.size(), "Could not parse date '" + std::string{string} + "'.");
+  return *date;
+}
+
+std::chrono::year_month_day Date::year_month_day() const {
+  return std::chrono::year_month_day{std::chrono::sys_days{std::chrono::days{_days_since_epoch}}};
+}
+
+Timestamp Timestamp::parse(const std::string_view string) {
+  const auto timestamp = try_parse_timestamp(string);
+  Assert(timestamp, "Could not parse timestamp '" + std::string{string} + "'.");
+  return *timestamp;
+}
+
+Date Timestamp::date() const {
+  // Division rounds towards zero, but timestamps before the epoch belong to the previous day.
+  auto days = _microseconds_since_epoch / MICROSECONDS_PER_DAY;
+  if (_microseconds_since_epoch % MICROSECONDS_PER_DAY < 0) {
+    --days;
+  }
+  return Date{static_cast<int32_t>(days)};
+}
+
+std::ostream& operator<<(std::ostream& stream, const Date& date) {
+  const auto year_month_day = date.year_month_day();
+  const auto fill = stream.fill('0');
+  stream << std::setw(4) << static_cast<int32_t>(year_month_day.year()) << '-' << std::setw(2)
+         << static_cast<uint32_t>(year_month_day.month()) << '-' << std::setw(2)
+         << static_cast<uint32_t>(year_month_day.day());
+  stream.fill(fill);
+  return stream;
+}
+
+std::istream& operator>>(std::istream& stream, Date& date) {
+  const auto token = read_token(stream);
+  auto position = size_t{0};
+  const auto parsed_date = try_parse_date(token, position);
+  if (!parsed_date || position != token.size()) {
+    stream.setstate(std::ios::failbit);
+    return stream;
+  }
+  date = *parsed_date;
+  return stream;
+}
+
+std::ostream& operator<<(std::ostream& stream, const Timestamp& timestamp) {
+  const auto date = timestamp.date();
+  const auto time_of_day = timestamp.microseconds_since_epoch() - Timestamp{date}.microseconds_since_epoch();
+  const auto seconds = time_of_day / 1'000'000;
+  const auto microseconds = time_of_day % 1'000'000;
+
+  stream << date << ' ';
+  const auto fill = stream.fill('0');
+  stream << std::setw(2) << seconds / 3600 << ':' << std::setw(2) << seconds / 60 % 60 << ':' << std::setw(2)
+         << seconds % 60;
+  if (microseconds != 0) {
+    stream << '.' << std::setw(6) << microseconds;
+  }
+  stream.fill(fill);
+  return stream;
+}
+
+std::istream& operator>>(std::istream& stream, Timestamp& timestamp) {
+  auto token = read_token(stream);
+  // A time may follow the date after a single space.
+  if (stream.peek() == ' ') {
+    stream.get();
+    token += ' ' + read_token(stream);
+  }
+  const auto parsed_timestamp = try_parse_timestamp(token);
+  if (!parsed_timestamp) {
+    stream.setstate(std::ios::failbit);
+    return stream;
+  }
+  timestamp = *parsed_timestamp;
+  return stream;
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string_view>
+
+namespace opossum {
+
+// Date is a calendar date in the proleptic Gregorian calendar. It is stored as the number of days since 1970-01-01 in
+// four bytes, so that dates can be compared and encoded like integers. Dates are read and written as "YYYY-MM-DD".
+class Date {
+ public:
+  constexpr Date() = default;
+
+  constexpr explicit Date(const int32_t days_since_epoch) : _days_since_epoch{days_since_epoch} {}
+
+  // Creates a date from a year, a month (1-12), and a day of the month. Fails for dates that do not exist.
+  static Date from_year_month_day(const int32_t year, const uint32_t month, const uint32_t day);
+
+  // Parses a date in the format "YYYY-MM-DD". Fails for malformed strings.
+  static Date parse(const std::string_view string);
+
+  constexpr int32_t days_since_epoch() const {
+    return _days_since_epoch;
+  }
+
+  std::chrono::year_month_day year_month_day() const;
+
+  friend constexpr bool operator==(const Date& lhs, const Date& rhs) = default;
+  friend constexpr auto operator<=>(const Date& lhs, const Date& rhs) = default;
+
+ protected:
+  int32_t _days_since_epoch{0};
+};
+
+// Timestamp is a point in time without time zone. It is stored as the number of microseconds since 1970-01-01 00:00:00
+// in eight bytes. Timestamps are read and written as "YYYY-MM-DD HH:MM:SS[.ffffff]". When reading, the time may be
+// omitted, which means midnight.
+class Timestamp {
+ public:
+  static constexpr auto MICROSECONDS_PER_DAY = int64_t{24} * 60 * 60 * 1'000'000;
+
+  constexpr Timestamp() = default;
+
+  constexpr explicit Timestamp(const int64_t microseconds_since_epoch)
+      : _microseconds_since_epoch{microseconds_since_epoch} {}
+
+  // Creates a timestamp at midnight of the given date.
+  constexpr explicit Timestamp(const Date date)
+      : _microseconds_since_epoch{int64_t{date.days_since_epoch()} * MICROSECONDS_PER_DAY} {}
+
+  // Parses a timestamp in the format "YYYY-MM-DD[ HH:MM:SS[.ffffff]]". Fails for malformed strings.
+  static Timestamp parse(const std::string_view string);
+
+  constexpr int64_t microseconds_since_epoch() const {
+    return _microseconds_since_epoch;
+  }
+
+  // Returns the date of the timestamp, i.e., the timestamp rounded down to the day.
+  Date date() const;
+
+  friend constexpr bool operator==(const Timestamp& lhs, const Timestamp& rhs) = default;
+  friend constexpr auto operator<=>(const Timestamp& lhs, const Timestamp& rhs) = default;
+
+ protected:
+  int64_t _microseconds_since_epoch{0};
+};
+
+// The stream operators are used by boost::lexical_cast, i.e., by type_cast from and to strings. Reading malformed
+// values sets the failbit.
+std::ostream& operator<<(std::ostream& stream, const Date& date);
+std::istream& operator>>(std::istream& stream, Date& date);
+std::ostream& operator<<(std::ostream& stream, const Timestamp& timestamp);
+std::istream& operator>>(std::istream& stream, Timestamp& timestamp);
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::Date> {
+  size_t operator()(const opossum::Date& date) const {
+    return std::hash<int32_t>{}(date.days_since_epoch());
+  }
+};
+
+template <>
+struct hash<opossum::Timestamp> {
+  size_t operator()(const opossum::Timestamp& timestamp) const {
+    return std::hash<int64_t>{}(timestamp.microseconds_since_epoch());
+  }
+};
+
+}  // namespace std
@@ -0,0 +1,140 @@
+#include "decimal.hpp"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <optional>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::optional<Decimal> try_parse_decimal(const std::string_view string) {
+  auto position = size_t{0};
+  const auto is_negative = !string.empty() && string[0] == '-';
+  if (!string.empty() && (string[0] == '-' || string[0] == '+')) {
+    ++position;
+  }
+
+  // The magnitude is accumulated as a negative number, which can also hold the smallest int64_t.
+  constexpr auto MIN_VALUE = std::numeric_limits<int64_t>::min();
+  auto negative_magnitude = int64_t{0};
+  auto digit_count = size_t{0};
+  const auto append_digit = [&](const int64_t digit) {
+    if (negative_magnitude < (MIN_VALUE + digit) / 10) {
+      return false;
+    }
+    negative_magnitude = negative_magnitude * 10 - digit;
+    return true;
+  };
+
+  for (; position < string.size() && std::isdigit(string[position]); ++position, ++digit_count) {
+    if (!append_digit(string[position] - '0')) {
+      return std::nullopt;
+    }
+  }
+
+  auto fractional_digit_count = size_t{0};
+  auto round_up = false;
+  if (position < string.size() && string[position] == '.') {
+    ++position;
+    for (; position < string.size() && std::isdigit(string[position]); ++position, ++digit_count) {
+      if (fractional_digit_count < Decimal::SCALE) {
+        if (!append_digit(string[position] - '0')) {
+          return std::nullopt;
+        }
+        ++fractional_digit_count;
+      } else if (fractional_digit_count == Decimal::SCALE) {
+        // Only the first digit after the scale determines the rounding.
+        round_up = string[position] >= '5';
+        ++fractional_digit_count;
+      }
+    }
+  }
+
+  if (digit_count == 0 || position != string.size()) {
+    return std::nullopt;
+  }
+  for (; fractional_digit_count < Decimal::SCALE; ++fractional_digit_count) {
+    if (!append_digit(0)) {
+      return std::nullopt;
+    }
+  }
+  if (round_up) {
+    if (negative_magnitude == MIN_VALUE) {
+      return std::nullopt;
+    }
+    --negative_magnitude;
+  }
+
+  if (is_negative) {
+    return Decimal::from_unscaled(negative_magnitude);
+  }
+  if (negative_magnitude == MIN_VALUE) {
+    return std::nullopt;
+  }
+  return Decimal::from_unscaled(-negative_magnitude);
+}
+
+}  // namespace
+
+Decimal Decimal::from_integer(const int64_t value) {
+  Assert(value <= std::numeric_limits<int64_t>::max() / SCALE_FACTOR &&
+             value >= std::numeric_limits<int64_t>::min() / SCALE_FACTOR,
+         "Integer " + std::to_string(value) + " cannot be represented as Decimal.");
+  return from_unscaled(value * SCALE_FACTOR);
+}
+
+Decimal Decimal::from_double(const double value) {
+  const auto scaled_value = std::round(value * static_cast<double>(SCALE_FACTOR));
+  // 2^63 is exactly representable as double, int64_t's maximum is not.
+  Assert(std::isfinite(scaled_value) && scaled_value >= -0x1p63 && scaled_value < 0x1p63,
+         "Value " + std::to_string(value) + " cannot be represented as Decimal.");
+  return from_unscaled(static_cast<int64_t>(scaled_value));
+}
+
+Decimal Decimal::parse(const std::string_view string) {
+  const auto decimal = try_parse_decimal(string);
+  Assert(decimal, "Could not parse decimal '" + std::string{string} + "'.");
+  return *decimal;
+}
+
+double Decimal::to_double() const {
+  return static_cast<double>(_unscaled_value) / static_cast<double>(SCALE_FACTOR);
+}
+
+int64_t Decimal::to_integer() const {
+  return _unscaled_value / SCALE_FACTOR;
+}
+
+std::ostream& operator<<(std::ostream& stream, const Decimal& decimal) {
+  // Both parts are computed before taking their absolute values, as negating the smallest int64_t would overflow.
+  const auto unscaled_value = decimal.unscaled_value();
+  if (unscaled_value < 0) {
+    stream << '-';
+  }
+  const auto fill = stream.fill('0');
+  stream << std::abs(unscaled_value / Decimal::SCALE_FACTOR) << '.' << std::setw(Decimal::SCALE)
+         << std::abs(unscaled_value % Decimal::SCALE_FACTOR);
+  stream.fill(fill);
+  return stream;
+}
+
+std::istream& operator>>(std::istream& stream, Decimal& decimal) {
+  auto token = std::string{};
+  stream >> token;
+  const auto parsed_decimal = try_parse_decimal(token);
+  if (!parsed_decimal) {
+    stream.setstate(std::ios::failbit);
+    return stream;
+  }
+  decimal = *parsed_decimal;
+  return stream;
+}
+
+}  // namespace opossum
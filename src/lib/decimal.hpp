@@ -0,0 +1,69 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string_view>
+
+namespace opossum {
+
+// Decimal is a fixed-point number with SCALE digits after the decimal point, e.g., for monetary values that must not
+// suffer from the rounding errors of binary floating-point numbers. It is stored as a 64-bit integer that holds the
+// value multiplied by 10^SCALE (the unscaled value), so that comparisons are integer comparisons. Decimals are read and
+// written as, e.g., "-12.3456". When reading, more than SCALE fractional digits are rounded half away from zero.
+class Decimal {
+ public:
+  static constexpr auto SCALE = uint8_t{4};
+  static constexpr auto SCALE_FACTOR = int64_t{10'000};
+
+  constexpr Decimal() = default;
+
+  // Creates a decimal from its unscaled value, e.g., Decimal::from_unscaled(12'345) is 1.2345.
+  static constexpr Decimal from_unscaled(const int64_t unscaled_value) {
+    auto decimal = Decimal{};
+    decimal._unscaled_value = unscaled_value;
+    return decimal;
+  }
+
+  // Creates a decimal from an integer or a floating-point number, which is rounded to SCALE digits. Fails if the value
+  // cannot be represented.
+  static Decimal from_integer(const int64_t value);
+  static Decimal from_double(const double value);
+
+  // Parses a decimal number such as "-12.3456". Fails for malformed strings.
+  static Decimal parse(const std::string_view string);
+
+  constexpr int64_t unscaled_value() const {
+    return _unscaled_value;
+  }
+
+  double to_double() const;
+
+  // Returns the integral part, i.e., the value rounded towards zero.
+  int64_t to_integer() const;
+
+  friend constexpr bool operator==(const Decimal& lhs, const Decimal& rhs) = default;
+  friend constexpr auto operator<=>(const Decimal& lhs, const Decimal& rhs) = default;
+
+ protected:
+  int64_t _unscaled_value{0};
+};
+
+// The stream operators are used by boost::lexical_cast, i.e., by type_cast from and to strings. Reading malformed
+// values sets the failbit.
+std::ostream& operator<<(std::ostream& stream, const Decimal& decimal);
+std::istream& operator>>(std::istream& stream, Decimal& decimal);
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::Decimal> {
+  size_t operator()(const opossum::Decimal& decimal) const {
+    return std::hash<int64_t>{}(decimal.unscaled_value());
+  }
+};
+
+}  // namespace std
@@ -18,6 +18,15 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+void AbstractOperator::set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context) {
+  Assert(!_was_executed, "Transaction context has to be set before the operator is executed.");
+  _transaction_context = transaction_context;
+}
+
+std::shared_ptr<TransactionContext> AbstractOperator::transaction_context() const {
+  return _transaction_context;
+}
+
 std::shared_ptr<const Table> AbstractOperator::_left_input_table() const {
   return _left_input->get_output();
 }
@@ -7,6 +7,7 @@
 namespace opossum {
 
 class Table;
+class TransactionContext;
 
 // AbstractOperator is the abstract super class for all operators. All operators have up to two input tables and one
 // output table. Their lifecycle has three phases:
@@ -18,6 +19,9 @@ class Table;
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
 // Operators shall not be executed twice.
+//
+// Operators that are given a transaction context only consider the rows that are visible to the transaction (see
+// Validate).
 
 class AbstractOperator : private Noncopyable {
  public:
@@ -39,6 +43,12 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const AbstractOperator> left_input() const;
   std::shared_ptr<const AbstractOperator> right_input() const;
 
+  // Sets the transaction that the operator is executed in. Has to be called before execute.
+  void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // Returns the transaction that the operator is executed in or nullptr if it is executed outside of a transaction.
+  std::shared_ptr<TransactionContext> transaction_context() const;
+
  protected:
   // Abstract method to actually execute the operator execute and get_output are split into two methods to allow for
   // easier asynchronous execution.
@@ -52,6 +62,8 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const AbstractOperator> _left_input;
   std::shared_ptr<const AbstractOperator> _right_input;
 
+  std::shared_ptr<TransactionContext> _transaction_context;
+
   // Is nullptr until the operator is executed.
   std::shared_ptr<const Table> _output;
   bool _was_executed;
@@ -0,0 +1,61 @@
+#include "delete.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Delete::Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_delete)
+    : AbstractOperator(rows_to_delete), _table_name{table_name} {}
+
+const std::string& Delete::table_name() const {
+  return _table_name;
+}
+
+bool Delete::execute_failed() const {
+  return _execute_failed;
+}
+
+std::shared_ptr<const Table> Delete::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+  const auto input_table = _left_input_table();
+  Assert(input_table->column_count() > 0, "Delete needs an input with columns.");
+
+  const auto is_auto_commit = !_transaction_context;
+  const auto transaction_context =
+      is_auto_commit ? TransactionManager::get().new_transaction_context() : _transaction_context;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count() && !_execute_failed; ++chunk_id) {
+    const auto reference_segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(input_table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    Assert(reference_segment && reference_segment->referenced_table() == table,
+           "Input of Delete has to refer to the rows of the table.");
+
+    for (const auto& row_id : *reference_segment->pos_list()) {
+      // NULL positions, e.g., from outer joins, do not refer to a row.
+      if (row_id.is_null()) {
+        continue;
+      }
+      const auto mvcc_data = table->get_chunk(row_id.chunk_id)->mvcc_data();
+      Assert(mvcc_data, "Tried to delete a row without versioning information.");
+      if (!transaction_context->try_delete(mvcc_data, row_id.chunk_offset)) {
+        _execute_failed = true;
+        break;
+      }
+    }
+  }
+
+  if (is_auto_commit) {
+    if (_execute_failed) {
+      transaction_context->rollback();
+    } else {
+      transaction_context->commit();
+    }
+  }
+  return input_table;
+}
+
+}  // namespace opossum
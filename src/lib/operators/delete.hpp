@@ -0,0 +1,29 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Operator that deletes rows from a table of the StorageManager. Its input is the output of an operator, e.g., of a
+// TableScan, whose ReferenceSegments refer to the rows of the table, i.e., whose PosList holds the rows to delete. The
+// rows are deleted in the operator's transaction (see TransactionContext::try_delete). Without a transaction, the
+// rows are deleted in a transaction of their own, which is committed right away. If another transaction deleted one
+// of the rows, execute_failed() returns true and the transaction has to be rolled back (which happens automatically
+// without a transaction). The output is the input, i.e., the rows to delete.
+class Delete : public AbstractOperator {
+ public:
+  Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_delete);
+
+  const std::string& table_name() const;
+
+  // Returns whether the rows could not be deleted because of a write-write conflict.
+  bool execute_failed() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::string _table_name;
+  bool _execute_failed{false};
+};
+
+}  // namespace opossum
@@ -1,10 +1,20 @@
 #include "table_scan.hpp"
 
+#include <array>
+#include <span>
+
 #include "all_type_variant.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "resolve_type.hpp"
+#include "validate.hpp"
+#include "storage/bloom_filter.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/partitioning.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/resolve_attribute_vector.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -14,6 +24,30 @@ TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const Co
     : AbstractOperator(in), _column_id{column_id}, _scan_type{scan_type}, _search_value(search_value) {}
 
 namespace {
+
+// Number of value ids that are decoded at once when scanning dictionary segments. A multiple of
+// BitPackedIntegerVector::BLOCK_SIZE so that bit-packed vectors can unpack whole blocks.
+constexpr auto DECODE_BATCH_SIZE = size_t{1024};
+
+// Removes the rows that are not visible to a reader outside of transactions that reads the given snapshot, i.e., rows
+// that were not committed before the snapshot or whose deletion was. As the rows of a commit only become visible with
+// the commit as a whole, rows that a commit in progress moves (see Table::rebalance_chunks) are seen exactly once.
+void remove_rows_invisible_in_snapshot(const Table& referenced_table, const CommitID snapshot_commit_id,
+                                       PosList& pos_list) {
+  auto chunk_id = INVALID_CHUNK_ID;
+  auto mvcc_data = std::shared_ptr<const MvccData>{};
+  std::erase_if(pos_list, [&](const RowID& row_id) {
+    if (row_id.is_null()) {
+      return false;
+    }
+    if (row_id.chunk_id != chunk_id) {
+      chunk_id = row_id.chunk_id;
+      mvcc_data = referenced_table.get_chunk(chunk_id)->mvcc_data();
+    }
+    return mvcc_data && !mvcc_data->is_visible(row_id.chunk_offset, INVALID_TRANSACTION_ID, snapshot_commit_id);
+  });
+}
+
 template <typename T, typename U = T>
 auto predicate_for_scantype(ScanType scan_type) {
   switch (scan_type) {
@@ -35,19 +69,138 @@ auto predicate_for_scantype(ScanType scan_type) {
       Fail("Invalid Scan type.");
   }
 }
+
+// Calls functor for every position in [begin, end) that is not NULL according to null_values, which may be nullptr
+// for non-nullable segments. Words of the bitmap without NULL values are processed without checking each position.
+template <typename Functor>
+void for_each_non_null(const Bitmap* null_values, const ChunkOffset begin, const ChunkOffset end,
+                       const Functor& functor) {
+  if (!null_values) {
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      functor(chunk_offset);
+    }
+    return;
+  }
+
+  auto chunk_offset = begin;
+  while (chunk_offset < end) {
+    const auto word_index = chunk_offset / Bitmap::WORD_BITS;
+    const auto word_end = std::min(end, static_cast<ChunkOffset>((word_index + 1) * Bitmap::WORD_BITS));
+    const auto word = null_values->word(word_index);
+    if (word == 0) {
+      for (; chunk_offset < word_end; ++chunk_offset) {
+        functor(chunk_offset);
+      }
+    } else {
+      for (; chunk_offset < word_end; ++chunk_offset) {
+        if (!((word >> (chunk_offset % Bitmap::WORD_BITS)) & 1)) {
+          functor(chunk_offset);
+        }
+      }
+    }
+  }
+}
+
+// Adds all positions in [begin, end) to the pos list.
+void add_range(const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end, PosList& pos_list) {
+  pos_list.reserve(pos_list.size() + (end - begin));
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+    pos_list.push_back({chunk_id, chunk_offset});
+  }
+}
+
+// Returns the first position in [begin, end) for which the predicate does not hold, given that it holds for all
+// positions before and for none after that position.
+template <typename Predicate>
+ChunkOffset partition_point(ChunkOffset begin, ChunkOffset end, const Predicate& predicate) {
+  while (begin < end) {
+    const auto middle = static_cast<ChunkOffset>(begin + (end - begin) / 2);
+    if (predicate(middle)) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+// Adds the positions of a sorted segment whose values satisfy `value <scan_type> search_value`. The segment is only
+// accessed by binary searches for the NULL values and the bounds of the search value, using is_null(chunk_offset),
+// is_smaller(chunk_offset) for value < search_value, and is_not_bigger(chunk_offset) for value <= search_value. The
+// qualifying positions then form one or two contiguous ranges.
+template <typename IsNull, typename IsSmaller, typename IsNotBigger>
+void scan_sorted(const ChunkID chunk_id, const ChunkOffset size, const SortMode sort_mode, const ScanType scan_type,
+                 const IsNull& is_null, const IsSmaller& is_smaller, const IsNotBigger& is_not_bigger,
+                 PosList& pos_list) {
+  const auto nulls_first = sort_mode == SortMode::AscendingNullsFirst || sort_mode == SortMode::DescendingNullsFirst;
+  const auto ascending = sort_mode == SortMode::AscendingNullsFirst || sort_mode == SortMode::AscendingNullsLast;
+  const auto begin = nulls_first ? partition_point(ChunkOffset{0}, size, is_null) : ChunkOffset{0};
+  const auto end = nulls_first ? size : partition_point(ChunkOffset{0}, size, [&](const auto offset) {
+    return !is_null(offset);
+  });
+
+  // The values equal to the search value lie in [lower, upper). Smaller values are before them in ascending segments
+  // and after them in descending segments.
+  auto lower = ChunkOffset{0};
+  auto upper = ChunkOffset{0};
+  if (ascending) {
+    lower = partition_point(begin, end, is_smaller);
+    upper = partition_point(lower, end, is_not_bigger);
+  } else {
+    lower = partition_point(begin, end, [&](const auto offset) { return !is_not_bigger(offset); });
+    upper = partition_point(lower, end, [&](const auto offset) { return !is_smaller(offset); });
+  }
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      add_range(chunk_id, lower, upper, pos_list);
+      return;
+    case ScanType::OpNotEquals:
+      add_range(chunk_id, begin, lower, pos_list);
+      add_range(chunk_id, upper, end, pos_list);
+      return;
+    case ScanType::OpLessThan:
+      ascending ? add_range(chunk_id, begin, lower, pos_list) : add_range(chunk_id, upper, end, pos_list);
+      return;
+    case ScanType::OpLessThanEquals:
+      ascending ? add_range(chunk_id, begin, upper, pos_list) : add_range(chunk_id, lower, end, pos_list);
+      return;
+    case ScanType::OpGreaterThan:
+      ascending ? add_range(chunk_id, upper, end, pos_list) : add_range(chunk_id, begin, lower, pos_list);
+      return;
+    case ScanType::OpGreaterThanEquals:
+      ascending ? add_range(chunk_id, lower, end, pos_list) : add_range(chunk_id, begin, upper, pos_list);
+      return;
+    default:
+      Fail("Invalid Scan type.");
+  }
+}
+
+// Returns the NULL values of a segment or nullptr if the segment is not nullable.
+template <typename Segment>
+const Bitmap* null_values_or_nullptr(const Segment& segment) {
+  return segment.is_nullable() ? &segment.null_values() : nullptr;
+}
 }  // namespace
 
 template <typename T>
-void TableScan::_scan_value_segment(const ChunkID chunk_id, const ValueSegment<T>& segment, PosList& pos_list) {
+void TableScan::_scan_value_segment(const ChunkID chunk_id, const ValueSegment<T>& segment, const ChunkOffset begin,
+                                    const ChunkOffset end, PosList& pos_list) {
+  if (variant_is_null(_search_value)) {
+    return;
+  }
+
+  // Strings are compared as InlineStrings, which decide most comparisons based on their inlined prefix.
+  using StoredType = typename ValueSegment<T>::StoredType;
+  const auto& search_value = get<T>(_search_value);
+  const auto stored_search_value = StoredType{search_value};
   const auto& values = segment.values();
-  const auto segment_size = segment.size();
-  const auto predicate = predicate_for_scantype<T>(_scan_type);
-  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
-    if (!segment.is_null(chunk_offset) && !variant_is_null(_search_value) &&
-        predicate(values[chunk_offset], get<T>(_search_value))) {
+  const auto predicate = predicate_for_scantype<StoredType>(_scan_type);
+  for_each_non_null(null_values_or_nullptr(segment), begin, end, [&](const ChunkOffset chunk_offset) {
+    if (predicate(values[chunk_offset], stored_search_value)) {
       pos_list.push_back({chunk_id, chunk_offset});
     }
-  }
+  });
 }
 
 // Represents a ValueID that can be just between two integer numbers. This is used for comparing range scans of
@@ -77,18 +230,288 @@ struct InBetweenValueID {
 
 template <typename T>
 void TableScan::_scan_dictionary_segment(const ChunkID chunk_id, const DictionarySegment<T>& segment,
-                                         PosList& pos_list) {
+                                         const ChunkOffset begin, const ChunkOffset end, PosList& pos_list) {
+  // Comparisons with NULL never evaluate to true.
+  if (variant_is_null(_search_value)) {
+    return;
+  }
+
   const auto attribute_vector = segment.attribute_vector();
   const auto predicate = predicate_for_scantype<ValueID, InBetweenValueID>(_scan_type);
-  const auto segment_size = segment.size();
+  const auto null_value_id = segment.null_value_id();
 
   // Note: If _seach_value is larger than all values in the dictionary segment, then the ids returned are
-  //       INVALID_VALUE_ID - the biggest possible value of any ValueID, so the math checks out.
-  const auto comparison_value =
-      InBetweenValueID{segment.lower_bound(_search_value), segment.upper_bound(_search_value)};
+  //       INVALID_VALUE_ID - the biggest possible value of any ValueID, so the math checks out. NULL values are
+  //       represented by the first value id after the dictionary and have to be excluded explicitly.
+  if (!segment.has_shared_dictionary() || segment.shared_dictionary() != _bounds_dictionary) {
+    _dictionary_lower_bound = segment.lower_bound(_search_value);
+    _dictionary_upper_bound = segment.upper_bound(_search_value);
+    _bounds_dictionary = segment.has_shared_dictionary() ? segment.shared_dictionary() : nullptr;
+  }
+  const auto comparison_value = InBetweenValueID{_dictionary_lower_bound, _dictionary_upper_bound};
 
-  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
-    if (predicate(attribute_vector->get(chunk_offset), comparison_value)) {
+  resolve_attribute_vector(*attribute_vector, [&](const auto& typed_attribute_vector) {
+    auto value_ids = std::array<ValueID, DECODE_BATCH_SIZE>{};
+    for (auto batch_begin = begin; batch_begin < end; batch_begin += DECODE_BATCH_SIZE) {
+      const auto batch_size = std::min(DECODE_BATCH_SIZE, static_cast<size_t>(end - batch_begin));
+      typed_attribute_vector.decode(batch_begin, std::span{value_ids}.first(batch_size));
+
+      for (auto batch_offset = ChunkOffset{0}; batch_offset < batch_size; ++batch_offset) {
+        const auto value_id = value_ids[batch_offset];
+        if (value_id != null_value_id && predicate(value_id, comparison_value)) {
+          pos_list.push_back({chunk_id, batch_begin + batch_offset});
+        }
+      }
+    }
+  });
+}
+
+template <typename T>
+void TableScan::_scan_run_length_segment(const ChunkID chunk_id, const RunLengthSegment<T>& segment,
+                                         PosList& pos_list) {
+  if (variant_is_null(_search_value)) {
+    return;
+  }
+
+  // The predicate is evaluated once per run. All rows of a qualifying run are emitted without looking at them.
+  const auto& values = segment.values();
+  const auto& null_values = segment.null_values();
+  const auto& end_positions = segment.end_positions();
+  const auto predicate = predicate_for_scantype<T>(_scan_type);
+  const auto search_value = type_cast<T>(_search_value);
+  const auto run_count = segment.run_count();
+
+  auto run_begin = ChunkOffset{0};
+  for (auto run_index = ChunkOffset{0}; run_index < run_count; ++run_index) {
+    const auto run_end = end_positions[run_index];
+    if (!null_values[run_index] && predicate(values[run_index], search_value)) {
+      for (auto chunk_offset = run_begin; chunk_offset <= run_end; ++chunk_offset) {
+        pos_list.push_back({chunk_id, chunk_offset});
+      }
+    }
+    run_begin = run_end + 1;
+  }
+}
+
+template <typename T>
+void TableScan::_scan_frame_of_reference_segment(const ChunkID chunk_id, const FrameOfReferenceSegment<T>& segment,
+                                                 PosList& pos_list) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  if (variant_is_null(_search_value)) {
+    return;
+  }
+
+  const auto search_value = type_cast<T>(_search_value);
+  const auto& block_minima = segment.block_minima();
+  const auto& offsets = *segment.offsets();
+  const auto max_offset = (uint64_t{1} << offsets.bit_width()) - 1;
+  const auto predicate = predicate_for_scantype<ValueID>(_scan_type);
+  const auto segment_size = segment.size();
+  const auto* const null_values = null_values_or_nullptr(segment);
+
+  // Whether values below or above the search value qualify. Used for blocks whose value range does not contain the
+  // search value, as all of their values are either below or above it.
+  const auto smaller_values_qualify = predicate_for_scantype<int>(_scan_type)(0, 1);
+  const auto bigger_values_qualify = predicate_for_scantype<int>(_scan_type)(1, 0);
+
+  auto block_offsets = std::array<ValueID, FrameOfReferenceSegment<T>::BLOCK_SIZE>{};
+  for (auto block_index = size_t{0}; block_index < block_minima.size(); ++block_index) {
+    const auto block_begin = static_cast<ChunkOffset>(block_index * FrameOfReferenceSegment<T>::BLOCK_SIZE);
+    const auto block_end = std::min(block_begin + FrameOfReferenceSegment<T>::BLOCK_SIZE, segment_size);
+    const auto block_min = block_minima[block_index];
+
+    // The search value is rewritten into the offset space of the block. If it lies outside of the range representable
+    // by the offsets, the predicate has the same result for all values of the block.
+    auto search_offset = std::optional<ValueID>{};
+    auto all_qualify = false;
+    if (search_value < block_min) {
+      all_qualify = bigger_values_qualify;
+    } else {
+      const auto offset = static_cast<UnsignedT>(static_cast<UnsignedT>(search_value) - block_min);
+      if (offset > max_offset) {
+        all_qualify = smaller_values_qualify;
+      } else {
+        search_offset = ValueID{static_cast<ValueID::base_type>(offset)};
+      }
+    }
+
+    if (!search_offset && !all_qualify) {
+      continue;
+    }
+
+    if (search_offset) {
+      offsets.decode(block_begin, std::span{block_offsets}.first(block_end - block_begin));
+    }
+
+    for_each_non_null(null_values, block_begin, block_end, [&](const ChunkOffset chunk_offset) {
+      if (!search_offset || predicate(block_offsets[chunk_offset - block_begin], *search_offset)) {
+        pos_list.push_back({chunk_id, chunk_offset});
+      }
+    });
+  }
+}
+
+template <typename T>
+void TableScan::_scan_delta_encoded_segment(const ChunkID chunk_id, const DeltaEncodedSegment<T>& segment,
+                                            PosList& pos_list) {
+  constexpr auto BLOCK_SIZE = DeltaEncodedSegment<T>::BLOCK_SIZE;
+
+  if (variant_is_null(_search_value)) {
+    return;
+  }
+
+  const auto search_value = type_cast<T>(_search_value);
+  const auto segment_size = segment.size();
+  const auto* const null_values = null_values_or_nullptr(segment);
+  auto block_values = std::array<T, BLOCK_SIZE>{};
+
+  if (!segment.is_sorted()) {
+    const auto predicate = predicate_for_scantype<T>(_scan_type);
+    const auto block_count = segment.block_count();
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      const auto block_begin = static_cast<ChunkOffset>(block_index * BLOCK_SIZE);
+      const auto block_end = std::min(block_begin + BLOCK_SIZE, segment_size);
+      segment.decode_block(block_index, block_values);
+
+      for_each_non_null(null_values, block_begin, block_end, [&](const ChunkOffset chunk_offset) {
+        if (predicate(block_values[chunk_offset - block_begin], search_value)) {
+          pos_list.push_back({chunk_id, chunk_offset});
+        }
+      });
+    }
+    return;
+  }
+
+  // For sorted segments, the positions of the first value not smaller than the search value and the first value
+  // bigger than it are found by a binary search over the checkpoints followed by a binary search within one block.
+  // Every predicate then qualifies one or two contiguous ranges of positions.
+  const auto& checkpoints = segment.checkpoints();
+  const auto find_position = [&](const auto& bound) {
+    const auto block_end = static_cast<size_t>(bound(checkpoints.begin(), checkpoints.end()) - checkpoints.begin());
+    if (block_end == 0) {
+      return ChunkOffset{0};
+    }
+
+    // The position lies within the block before block_end or at the beginning of block_end.
+    const auto block_index = block_end - 1;
+    const auto block_begin = static_cast<ChunkOffset>(block_index * BLOCK_SIZE);
+    const auto block_length = std::min(BLOCK_SIZE, segment_size - block_begin);
+    segment.decode_block(block_index, block_values);
+    const auto block = std::span{block_values}.first(block_length);
+    return static_cast<ChunkOffset>(block_begin + (bound(block.begin(), block.end()) - block.begin()));
+  };
+  const auto lower = find_position([&](auto begin, auto end) { return std::lower_bound(begin, end, search_value); });
+  const auto upper = find_position([&](auto begin, auto end) { return std::upper_bound(begin, end, search_value); });
+
+  const auto add_range = [&](const ChunkOffset begin, const ChunkOffset end) {
+    for_each_non_null(null_values, begin, end,
+                      [&](const ChunkOffset chunk_offset) { pos_list.push_back({chunk_id, chunk_offset}); });
+  };
+
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      add_range(lower, upper);
+      return;
+    case ScanType::OpNotEquals:
+      add_range(0, lower);
+      add_range(upper, segment_size);
+      return;
+    case ScanType::OpLessThan:
+      add_range(0, lower);
+      return;
+    case ScanType::OpLessThanEquals:
+      add_range(0, upper);
+      return;
+    case ScanType::OpGreaterThan:
+      add_range(upper, segment_size);
+      return;
+    case ScanType::OpGreaterThanEquals:
+      add_range(lower, segment_size);
+      return;
+    default:
+      Fail("Invalid Scan type.");
+  }
+}
+
+template <typename T>
+void TableScan::_scan_gorilla_segment(const ChunkID chunk_id, const GorillaSegment<T>& segment, PosList& pos_list) {
+  if (variant_is_null(_search_value)) {
+    return;
+  }
+
+  const auto search_value = type_cast<T>(_search_value);
+  const auto predicate = predicate_for_scantype<T>(_scan_type);
+  const auto segment_size = segment.size();
+  const auto* const null_values = null_values_or_nullptr(segment);
+  const auto block_count = segment.block_count();
+
+  // Each block is decoded once into a buffer that is then scanned like a ValueSegment.
+  auto block_values = std::array<T, GorillaSegment<T>::BLOCK_SIZE>{};
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_begin = static_cast<ChunkOffset>(block_index * GorillaSegment<T>::BLOCK_SIZE);
+    const auto block_end = std::min(block_begin + GorillaSegment<T>::BLOCK_SIZE, segment_size);
+    segment.decode_block(block_index, block_values);
+
+    for_each_non_null(null_values, block_begin, block_end, [&](const ChunkOffset chunk_offset) {
+      if (predicate(block_values[chunk_offset - block_begin], search_value)) {
+        pos_list.push_back({chunk_id, chunk_offset});
+      }
+    });
+  }
+}
+
+template <typename T>
+void TableScan::_scan_lz_segment(const ChunkID chunk_id, const LZSegment<T>& segment, PosList& pos_list) {
+  if (variant_is_null(_search_value)) {
+    return;
+  }
+
+  const auto search_value = type_cast<T>(_search_value);
+  const auto predicate = predicate_for_scantype<T>(_scan_type);
+  const auto* const null_values = null_values_or_nullptr(segment);
+  const auto block_count = segment.block_count();
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_values = segment.decompressed_block(block_index);
+    const auto block_begin = static_cast<ChunkOffset>(block_index * LZSegment<T>::BLOCK_SIZE);
+    const auto block_size = static_cast<ChunkOffset>(block_values->size());
+
+    for_each_non_null(null_values, block_begin, block_begin + block_size, [&](const ChunkOffset chunk_offset) {
+      if (predicate((*block_values)[chunk_offset - block_begin], search_value)) {
+        pos_list.push_back({chunk_id, chunk_offset});
+      }
+    });
+  }
+}
+
+template <typename T>
+void TableScan::_scan_unsorted_dictionary_segment(const ChunkID chunk_id, const UnsortedDictionarySegment<T>& segment,
+                                                  const ChunkOffset end, PosList& pos_list) {
+  using DictionaryValue = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+  if (variant_is_null(_search_value)) {
+    return;
+  }
+
+  // The predicate is evaluated once per distinct value. As the dictionary is unsorted, the qualifying ValueIDs do not
+  // form a range and are marked in a bitmap instead. The dictionary is read after the size of the segment, so that it
+  // contains the values of all rows before end even if rows are appended concurrently.
+  const auto search_value = type_cast<T>(_search_value);
+  const auto predicate = predicate_for_scantype<DictionaryValue>(_scan_type);
+  const auto dictionary = segment.dictionary();
+  auto qualifying_value_ids = Bitmap(dictionary.size());
+  for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+    if (predicate(dictionary[value_id], search_value)) {
+      qualifying_value_ids.set(value_id);
+    }
+  }
+
+  const auto value_ids = segment.value_ids();
+  const auto null_value_id = segment.null_value_id();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < end; ++chunk_offset) {
+    const auto value_id = value_ids[chunk_offset];
+    if (value_id != null_value_id && qualifying_value_ids[value_id]) {
       pos_list.push_back({chunk_id, chunk_offset});
     }
   }
@@ -125,24 +548,153 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   auto referenced_table = input_table;
   auto pos_list = std::make_shared<PosList>();
   auto reference_segment_count = 0;
+  _bounds_dictionary = nullptr;
+  // The positions stay valid until the output refers to them. Outside of transactions, the scan reads the snapshot of
+  // the last commit after that, so that the rows of chunks that were reclaimed in the meantime are not visible.
+  const auto chunk_id_pin = input_table->pin_chunk_ids();
+  const auto snapshot_commit_id = TransactionManager::get().last_commit_id();
+
+  // All chunks of partitions that cannot contain qualifying rows are skipped.
+  auto partition_may_match = std::vector<bool>(input_table->partition_count(), true);
+  if (const auto partitioning = input_table->partitioning(); partitioning && partitioning->column_id() == _column_id) {
+    for (auto partition_id = PartitionID{0}; partition_id < partition_may_match.size(); ++partition_id) {
+      partition_may_match[partition_id] = partitioning->may_match(partition_id, _scan_type, _search_value);
+    }
+  }
 
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!partition_may_match[input_table->partition_id(chunk_id)]) {
+      continue;
+    }
     const auto chunk = input_table->get_chunk(chunk_id);
     const auto segment = chunk->get_segment(_column_id);
+    // Transactions may append to mutable chunks while they are scanned. Only the rows before the chunk's size read
+    // here are scanned, and the chunk's zone maps, which are updated after its rows, are not used.
+    const auto is_chunk_mutable = input_table->is_chunk_mutable(chunk_id);
+    const auto chunk_size = chunk->size();
 
     resolve_data_type(input_table->column_type(_column_id), [&](auto type) {
       using Type = typename decltype(type)::type;
       const auto value_segment = std::dynamic_pointer_cast<ValueSegment<Type>>(segment);
       const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<Type>>(segment);
+      const auto run_length_segment = std::dynamic_pointer_cast<RunLengthSegment<Type>>(segment);
+      const auto lz_segment = std::dynamic_pointer_cast<LZSegment<Type>>(segment);
+      const auto unsorted_dictionary_segment = std::dynamic_pointer_cast<UnsortedDictionarySegment<Type>>(segment);
       const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment);
 
-      DebugAssert(value_segment || dictionary_segment || reference_segment,
-                  "Segment has to be ValueSegment, DictionarySegment or ReferenceSegment.");
+      // The zone map allows skipping chunks that cannot contain qualifying rows and emitting chunks whose rows all
+      // qualify without looking at their values. Value and dictionary segments are handled the same way per block.
+      // For equality predicates, the Bloom filter allows skipping chunks whose value range contains the search value.
+      // Sorted value and dictionary segments are binary searched.
+      const auto zone_map = std::dynamic_pointer_cast<const ZoneMap<Type>>(chunk->get_zone_map(_column_id));
+      const auto bloom_filter = chunk->get_bloom_filter(_column_id);
+      const auto sort_mode = chunk->sort_mode(_column_id);
+      if ((zone_map || bloom_filter || sort_mode) && !is_chunk_mutable && !variant_is_null(_search_value)) {
+        const auto search_value = type_cast<Type>(_search_value);
+        const auto chunk_match =
+            zone_map ? ZoneMap<Type>::match(zone_map->zone(), _scan_type, search_value) : ZoneMatch::Some;
+        if (chunk_match == ZoneMatch::None) {
+          return;
+        }
+        if (chunk_match == ZoneMatch::All) {
+          add_range(chunk_id, 0, segment->size(), *pos_list);
+          return;
+        }
+        if (bloom_filter && _scan_type == ScanType::OpEquals && !bloom_filter->may_contain(search_value)) {
+          return;
+        }
+
+        if (sort_mode && value_segment) {
+          using StoredType = typename ValueSegment<Type>::StoredType;
+          const auto& values = value_segment->values();
+          const auto stored_search_value = StoredType{search_value};
+          scan_sorted(
+              chunk_id, value_segment->size(), *sort_mode, _scan_type,
+              [&](const ChunkOffset chunk_offset) { return value_segment->is_null(chunk_offset); },
+              [&](const ChunkOffset chunk_offset) { return values[chunk_offset] < stored_search_value; },
+              [&](const ChunkOffset chunk_offset) { return !(stored_search_value < values[chunk_offset]); },
+              *pos_list);
+          return;
+        }
+        if (sort_mode && dictionary_segment) {
+          // Value ids are ordered like the values, so that the bounds of the search value can be compared instead.
+          const auto& attribute_vector = *dictionary_segment->attribute_vector();
+          const auto null_value_id = dictionary_segment->null_value_id();
+          const auto lower_bound = dictionary_segment->lower_bound(search_value);
+          const auto upper_bound = dictionary_segment->upper_bound(search_value);
+          scan_sorted(
+              chunk_id, dictionary_segment->size(), *sort_mode, _scan_type,
+              [&](const ChunkOffset chunk_offset) { return attribute_vector.get(chunk_offset) == null_value_id; },
+              [&](const ChunkOffset chunk_offset) { return attribute_vector.get(chunk_offset) < lower_bound; },
+              [&](const ChunkOffset chunk_offset) { return attribute_vector.get(chunk_offset) < upper_bound; },
+              *pos_list);
+          return;
+        }
+
+        if (zone_map && !zone_map->block_zones().empty() && (value_segment || dictionary_segment)) {
+          const auto& block_zones = zone_map->block_zones();
+          const auto scan_range = [&](const ZoneMatch match, const ChunkOffset begin, const ChunkOffset end) {
+            if (match == ZoneMatch::All) {
+              add_range(chunk_id, begin, end, *pos_list);
+            } else if (match == ZoneMatch::Some && value_segment) {
+              _scan_value_segment(chunk_id, *value_segment, begin, end, *pos_list);
+            } else if (match == ZoneMatch::Some) {
+              _scan_dictionary_segment(chunk_id, *dictionary_segment, begin, end, *pos_list);
+            }
+          };
+
+          // Consecutive blocks with the same match are handled as one range.
+          auto range_match = ZoneMatch::None;
+          auto range_begin = ChunkOffset{0};
+          auto range_end = ChunkOffset{0};
+          for (const auto& block_zone : block_zones) {
+            const auto block_match = ZoneMap<Type>::match(block_zone, _scan_type, search_value);
+            if (block_match != range_match) {
+              scan_range(range_match, range_begin, range_end);
+              range_match = block_match;
+              range_begin = range_end;
+            }
+            range_end += block_zone.row_count;
+          }
+          scan_range(range_match, range_begin, range_end);
+          return;
+        }
+      }
+
+      if constexpr (std::is_integral_v<Type>) {
+        if (const auto frame_of_reference_segment =
+                std::dynamic_pointer_cast<FrameOfReferenceSegment<Type>>(segment)) {
+          _scan_frame_of_reference_segment(chunk_id, *frame_of_reference_segment, *pos_list);
+          return;
+        }
+        if (const auto delta_encoded_segment = std::dynamic_pointer_cast<DeltaEncodedSegment<Type>>(segment)) {
+          _scan_delta_encoded_segment(chunk_id, *delta_encoded_segment, *pos_list);
+          return;
+        }
+      }
+
+      if constexpr (std::is_floating_point_v<Type>) {
+        if (const auto gorilla_segment = std::dynamic_pointer_cast<GorillaSegment<Type>>(segment)) {
+          _scan_gorilla_segment(chunk_id, *gorilla_segment, *pos_list);
+          return;
+        }
+      }
+
+      DebugAssert(value_segment || dictionary_segment || run_length_segment || lz_segment ||
+                      unsorted_dictionary_segment || reference_segment,
+                  "Segment has to be ValueSegment, DictionarySegment, RunLengthSegment, FrameOfReferenceSegment, "
+                  "DeltaEncodedSegment, GorillaSegment, LZSegment, UnsortedDictionarySegment or ReferenceSegment.");
 
       if (value_segment) {
-        _scan_value_segment(chunk_id, *value_segment, *pos_list);
+        _scan_value_segment(chunk_id, *value_segment, 0, chunk_size, *pos_list);
       } else if (dictionary_segment) {
-        _scan_dictionary_segment(chunk_id, *dictionary_segment, *pos_list);
+        _scan_dictionary_segment(chunk_id, *dictionary_segment, 0, dictionary_segment->size(), *pos_list);
+      } else if (run_length_segment) {
+        _scan_run_length_segment(chunk_id, *run_length_segment, *pos_list);
+      } else if (lz_segment) {
+        _scan_lz_segment(chunk_id, *lz_segment, *pos_list);
+      } else if (unsorted_dictionary_segment) {
+        _scan_unsorted_dictionary_segment(chunk_id, *unsorted_dictionary_segment, chunk_size, *pos_list);
       } else if (reference_segment) {
         _scan_reference_segment(*reference_segment, *pos_list);
         referenced_table = reference_segment->referenced_table();
@@ -154,6 +706,13 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   Assert(reference_segment_count == 0 || (chunk_count == 1 && reference_segment_count == 1),
          "Input table for TableScan did not follow expectations about reference segment placement in chunks.");
 
+  // Only the qualifying rows are validated, which are usually much fewer than the scanned rows.
+  if (_transaction_context) {
+    Validate::remove_invisible_rows(*referenced_table, *_transaction_context, *pos_list);
+  } else {
+    remove_rows_invisible_in_snapshot(*referenced_table, snapshot_commit_id, *pos_list);
+  }
+
   auto output_chunk = std::make_shared<Chunk>();
 
   const auto column_count = input_table->column_count();
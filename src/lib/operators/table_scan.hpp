@@ -2,12 +2,22 @@
 
 #include "abstract_operator.hpp"
 #include "all_type_variant.hpp"
+#include "storage/delta_encoded_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/gorilla_segment.hpp"
+#include "storage/lz_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/unsorted_dictionary_segment.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/zone_map.hpp"
 
 namespace opossum {
 
+// Outputs the rows whose value in the given column satisfies the predicate. In a transaction, only the rows visible to
+// the transaction are output. Otherwise, only the rows committed up to the last commit before the scan started are
+// output.
 class TableScan : public AbstractOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const ScanType scan_type,
@@ -22,15 +32,40 @@ class TableScan : public AbstractOperator {
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  // Value and dictionary segments can be scanned in ranges of rows [begin, end), so that blocks of the segment can be
+  // skipped according to the zone map.
   template <typename T>
-  void _scan_value_segment(ChunkID chunk_id, const ValueSegment<T>& segment, PosList& pos_list);
+  void _scan_value_segment(ChunkID chunk_id, const ValueSegment<T>& segment, ChunkOffset begin, ChunkOffset end,
+                           PosList& pos_list);
   template <typename T>
-  void _scan_dictionary_segment(ChunkID chunk_id, const DictionarySegment<T>& segment, PosList& pos_list);
+  void _scan_dictionary_segment(ChunkID chunk_id, const DictionarySegment<T>& segment, ChunkOffset begin,
+                                ChunkOffset end, PosList& pos_list);
+  template <typename T>
+  void _scan_run_length_segment(ChunkID chunk_id, const RunLengthSegment<T>& segment, PosList& pos_list);
+  template <typename T>
+  void _scan_frame_of_reference_segment(ChunkID chunk_id, const FrameOfReferenceSegment<T>& segment,
+                                        PosList& pos_list);
+  template <typename T>
+  void _scan_delta_encoded_segment(ChunkID chunk_id, const DeltaEncodedSegment<T>& segment, PosList& pos_list);
+  template <typename T>
+  void _scan_gorilla_segment(ChunkID chunk_id, const GorillaSegment<T>& segment, PosList& pos_list);
+  template <typename T>
+  void _scan_lz_segment(ChunkID chunk_id, const LZSegment<T>& segment, PosList& pos_list);
+  // Only the rows before end are scanned, as rows may be appended to the segment concurrently.
+  template <typename T>
+  void _scan_unsorted_dictionary_segment(ChunkID chunk_id, const UnsortedDictionarySegment<T>& segment,
+                                         ChunkOffset end, PosList& pos_list);
   void _scan_reference_segment(const ReferenceSegment& segment, PosList& pos_list);
 
   ColumnID _column_id;
   ScanType _scan_type;
   AllTypeVariant _search_value;
+
+  // DictionarySegments that share a table-wide dictionary also share the bounds of the search value, which are thus
+  // only searched once per dictionary.
+  std::shared_ptr<const void> _bounds_dictionary;
+  ValueID _dictionary_lower_bound{INVALID_VALUE_ID};
+  ValueID _dictionary_upper_bound{INVALID_VALUE_ID};
 };
 
 }  // namespace opossum
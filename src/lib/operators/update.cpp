@@ -0,0 +1,78 @@
+#include "update.hpp"
+
+#include <set>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "delete.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Update::Update(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_update,
+               const std::vector<std::pair<ColumnID, AllTypeVariant>>& column_values)
+    : AbstractOperator(rows_to_update), _table_name{table_name}, _column_values{column_values} {}
+
+const std::string& Update::table_name() const {
+  return _table_name;
+}
+
+bool Update::execute_failed() const {
+  return _execute_failed;
+}
+
+std::shared_ptr<const Table> Update::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+  const auto input_table = _left_input_table();
+  const auto column_count = table->column_count();
+  for (const auto& [column_id, value] : _column_values) {
+    Assert(column_id < column_count, "Tried to update a non-existent column.");
+  }
+
+  const auto is_auto_commit = !_transaction_context;
+  const auto transaction_context =
+      is_auto_commit ? TransactionManager::get().new_transaction_context() : _transaction_context;
+
+  const auto delete_operator = std::make_shared<Delete>(_table_name, _left_input);
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+  _execute_failed = delete_operator->execute_failed();
+
+  if (!_execute_failed) {
+    // The new versions are built from the old ones, which are not changed by the delete.
+    auto row = std::vector<AllTypeVariant>(column_count);
+    // The input might contain a row more than once, e.g., after a join, but there is only one new version per row.
+    auto updated_row_ids = std::set<RowID>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(
+          input_table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+      for (const auto& row_id : *reference_segment->pos_list()) {
+        // NULL positions, e.g., from outer joins, do not refer to a row (see Delete).
+        if (row_id.is_null() || !updated_row_ids.insert(row_id).second) {
+          continue;
+        }
+        const auto chunk = table->get_chunk(row_id.chunk_id);
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          row[column_id] = (*chunk->get_segment(column_id))[row_id.chunk_offset];
+        }
+        for (const auto& [column_id, value] : _column_values) {
+          row[column_id] = value;
+        }
+        table->append(row, *transaction_context);
+      }
+    }
+  }
+
+  if (is_auto_commit) {
+    if (_execute_failed) {
+      transaction_context->rollback();
+    } else {
+      transaction_context->commit();
+    }
+  }
+  return input_table;
+}
+
+}  // namespace opossum
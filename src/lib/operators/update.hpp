@@ -0,0 +1,34 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+// Operator that updates rows of a table of the StorageManager by setting the given columns to the given values. Like
+// Delete, its input refers to the rows to update. An update deletes the old version of each row and inserts the new
+// version at the end of the table in the same transaction, which is committed right away if the operator is executed
+// without a transaction. If another transaction deleted one of the rows, execute_failed() returns true and the
+// transaction has to be rolled back. The output is the input, i.e., the old versions of the rows.
+class Update : public AbstractOperator {
+ public:
+  Update(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_update,
+         const std::vector<std::pair<ColumnID, AllTypeVariant>>& column_values);
+
+  const std::string& table_name() const;
+
+  // Returns whether the rows could not be updated because of a write-write conflict.
+  bool execute_failed() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::string _table_name;
+  std::vector<std::pair<ColumnID, AllTypeVariant>> _column_values;
+  bool _execute_failed{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#include "validate.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Validate::Validate(const std::shared_ptr<const AbstractOperator>& in) : AbstractOperator(in) {}
+
+void Validate::remove_invisible_rows(const Table& referenced_table, const TransactionContext& transaction_context,
+                                     PosList& pos_list) {
+  // Positions are usually ordered by chunk, so that the MvccData is only looked up when the chunk changes.
+  auto chunk_id = INVALID_CHUNK_ID;
+  auto mvcc_data = std::shared_ptr<const MvccData>{};
+  std::erase_if(pos_list, [&](const RowID& row_id) {
+    if (row_id.is_null()) {
+      return false;
+    }
+    if (row_id.chunk_id != chunk_id) {
+      chunk_id = row_id.chunk_id;
+      mvcc_data = referenced_table.get_chunk(chunk_id)->mvcc_data();
+    }
+    return mvcc_data && !transaction_context.is_visible(*mvcc_data, row_id.chunk_offset);
+  });
+}
+
+std::shared_ptr<const Table> Validate::_on_execute() {
+  Assert(_transaction_context, "Validate has to be executed in a transaction.");
+  const auto input_table = _left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto referenced_table = input_table;
+  auto pos_list = std::make_shared<PosList>();
+  const auto first_chunk = input_table->get_chunk(ChunkID{0});
+  const auto reference_segment =
+      first_chunk->column_count() > 0
+          ? std::dynamic_pointer_cast<const ReferenceSegment>(first_chunk->get_segment(ColumnID{0}))
+          : nullptr;
+  if (reference_segment) {
+    Assert(chunk_count == 1, "Input table for Validate did not follow expectations about reference segment placement.");
+    referenced_table = reference_segment->referenced_table();
+    *pos_list = *reference_segment->pos_list();
+    remove_invisible_rows(*referenced_table, *_transaction_context, *pos_list);
+  } else {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      const auto mvcc_data = chunk->mvcc_data();
+      const auto chunk_size = chunk->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (!mvcc_data || _transaction_context->is_visible(*mvcc_data, chunk_offset)) {
+          pos_list->push_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+  }
+
+  auto output_chunk = std::make_shared<Chunk>();
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_chunk->add_segment(std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list));
+  }
+
+  return std::make_shared<Table>(*input_table, std::move(output_chunk));
+}
+
+}  // namespace opossum
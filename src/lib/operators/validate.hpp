@@ -0,0 +1,26 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+class TransactionContext;
+
+// Operator that removes all rows from its input that are not visible to the transaction that it is executed in (see
+// MvccData::is_visible), i.e., rows inserted by other transactions that committed after the transaction started,
+// uncommitted rows of other transactions, and deleted rows. The input is either a table or the output of another
+// operator, i.e., a table with a single chunk of ReferenceSegments. The output refers to the underlying table.
+class Validate : public AbstractOperator {
+ public:
+  explicit Validate(const std::shared_ptr<const AbstractOperator>& in);
+
+  // Removes the rows that are not visible to the transaction from a list of positions in the referenced table. Rows of
+  // chunks without MvccData are always visible. Used by operators that are executed in a transaction.
+  static void remove_invisible_rows(const Table& referenced_table, const TransactionContext& transaction_context,
+                                    PosList& pos_list);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include "types.hpp"
 
 namespace opossum {
@@ -14,9 +16,13 @@ class AbstractAttributeVector : private Noncopyable {
   AbstractAttributeVector(AbstractAttributeVector&&) = default;
   AbstractAttributeVector& operator=(AbstractAttributeVector&&) = default;
 
-  // Returns the value id at a given position.
+  // Returns the value id at a given position. Prefer decode() or resolve_attribute_vector() when accessing many values.
   virtual ValueID get(const size_t index) const = 0;
 
+  // Decodes output.size() consecutive value ids starting at position begin into output. This costs a single virtual
+  // call per batch instead of one per value.
+  virtual void decode(const size_t begin, std::span<ValueID> output) const = 0;
+
   // Sets the value id at a given position.
   virtual void set(const size_t index, const ValueID value_id) = 0;
 
@@ -25,6 +31,9 @@ class AbstractAttributeVector : private Noncopyable {
 
   // Returns the width of biggest value id in bytes.
   virtual AttributeVectorWidth width() const = 0;
+
+  // Returns the calculated memory usage.
+  virtual size_t estimate_memory_usage() const = 0;
 };
 
 }  // namespace opossum
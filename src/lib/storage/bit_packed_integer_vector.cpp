@@ -0,0 +1,121 @@
+#include "bit_packed_integer_vector.hpp"
+
+#include <array>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto WORD_BITS = size_t{64};
+
+// Unpacks one block with a compile-time bit width. Because bit_width and BLOCK_SIZE are constants, all shifts and word
+// indices are known at compile time and the loop is fully unrolled.
+template <size_t bit_width>
+void unpack_block_with_width(const uint64_t* words, ValueID* output) {
+  constexpr auto mask = (uint64_t{1} << bit_width) - 1;
+  for (auto index = size_t{0}; index < BitPackedIntegerVector::BLOCK_SIZE; ++index) {
+    const auto bit = index * bit_width;
+    const auto word = bit / WORD_BITS;
+    const auto shift = bit % WORD_BITS;
+    auto value = words[word] >> shift;
+    if (shift + bit_width > WORD_BITS) {
+      value |= words[word + 1] << (WORD_BITS - shift);
+    }
+    output[index] = ValueID{static_cast<ValueID::base_type>(value & mask)};
+  }
+}
+
+using UnpackFunction = void (*)(const uint64_t*, ValueID*);
+
+template <size_t... bit_width_indices>
+constexpr auto make_unpack_functions(std::index_sequence<bit_width_indices...> /*indices*/) {
+  return std::array<UnpackFunction, sizeof...(bit_width_indices)>{&unpack_block_with_width<bit_width_indices + 1>...};
+}
+
+// UNPACK_FUNCTIONS[bit_width - 1] unpacks a block of values with the given bit width.
+constexpr auto UNPACK_FUNCTIONS = make_unpack_functions(std::make_index_sequence<32>{});
+
+}  // namespace
+
+BitPackedIntegerVector::BitPackedIntegerVector(size_t size, uint8_t bit_width) : _size{size}, _bit_width{bit_width} {
+  Assert(bit_width >= 1 && bit_width <= 32, "BitPackedIntegerVector only supports bit widths from 1 to 32.");
+  // Allocate whole blocks so that unpack_block never reads past the end of _words.
+  const auto block_count = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _words.resize(block_count * bit_width);
+}
+
+ValueID BitPackedIntegerVector::get(const size_t index) const {
+  DebugAssert(index < _size, "Tried to access BitPackedIntegerVector out of bounds.");
+  const auto bit = index * _bit_width;
+  const auto word = bit / WORD_BITS;
+  const auto shift = bit % WORD_BITS;
+  auto value = _words[word] >> shift;
+  if (shift + _bit_width > WORD_BITS) {
+    value |= _words[word + 1] << (WORD_BITS - shift);
+  }
+  const auto mask = (uint64_t{1} << _bit_width) - 1;
+  return ValueID{static_cast<ValueID::base_type>(value & mask)};
+}
+
+void BitPackedIntegerVector::decode(const size_t begin, std::span<ValueID> output) const {
+  Assert(begin + output.size() <= _size, "Tried to decode BitPackedIntegerVector out of bounds.");
+  const auto end = begin + output.size();
+  auto index = begin;
+
+  // Values before the first block boundary are extracted one by one.
+  for (; index < end && index % BLOCK_SIZE != 0; ++index) {
+    output[index - begin] = get(index);
+  }
+
+  const auto unpack = UNPACK_FUNCTIONS[_bit_width - 1];
+  for (; index + BLOCK_SIZE <= end; index += BLOCK_SIZE) {
+    unpack(_words.data() + (index / BLOCK_SIZE) * _bit_width, output.data() + (index - begin));
+  }
+
+  for (; index < end; ++index) {
+    output[index - begin] = get(index);
+  }
+}
+
+void BitPackedIntegerVector::set(const size_t index, const ValueID value_id) {
+  Assert(index < _size, "Tried to set value of BitPackedIntegerVector out of bounds.");
+  const auto mask = (uint64_t{1} << _bit_width) - 1;
+  Assert(value_id <= mask, "Value id " + std::to_string(value_id) + " does not fit into " +
+                               std::to_string(_bit_width) + " bits.");
+  const auto value = static_cast<uint64_t>(value_id);
+  const auto bit = index * _bit_width;
+  const auto word = bit / WORD_BITS;
+  const auto shift = bit % WORD_BITS;
+
+  _words[word] = (_words[word] & ~(mask << shift)) | (value << shift);
+  if (shift + _bit_width > WORD_BITS) {
+    const auto spilled_bits = WORD_BITS - shift;
+    _words[word + 1] = (_words[word + 1] & ~(mask >> spilled_bits)) | (value >> spilled_bits);
+  }
+}
+
+size_t BitPackedIntegerVector::size() const {
+  return _size;
+}
+
+AttributeVectorWidth BitPackedIntegerVector::width() const {
+  return static_cast<AttributeVectorWidth>((_bit_width + 7) / 8);
+}
+
+size_t BitPackedIntegerVector::estimate_memory_usage() const {
+  return _words.size() * sizeof(uint64_t);
+}
+
+uint8_t BitPackedIntegerVector::bit_width() const {
+  return _bit_width;
+}
+
+void BitPackedIntegerVector::unpack_block(const size_t block_index, std::span<ValueID, BLOCK_SIZE> output) const {
+  DebugAssert(block_index * BLOCK_SIZE < _size, "Tried to unpack block of BitPackedIntegerVector out of bounds.");
+  UNPACK_FUNCTIONS[_bit_width - 1](_words.data() + block_index * _bit_width, output.data());
+}
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "abstract_attribute_vector.hpp"
+
+namespace opossum {
+
+// BitPackedIntegerVector stores each value id with exactly bit_width bits (1 to 32). Values are laid out as one
+// contiguous little-endian bit stream in 64-bit words. Since BLOCK_SIZE is 64, every block of BLOCK_SIZE value ids
+// starts at a word boundary and occupies exactly bit_width words, which allows unpacking whole blocks with a
+// branch-free, width-specialized loop that the compiler can unroll and vectorize.
+class BitPackedIntegerVector final : public AbstractAttributeVector {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{64};
+
+  BitPackedIntegerVector(size_t size, uint8_t bit_width);
+
+  // Returns the value id at a given position.
+  ValueID get(const size_t index) const override;
+
+  // Decodes output.size() consecutive value ids starting at position begin into output. Whole blocks are unpacked
+  // directly into output.
+  void decode(const size_t begin, std::span<ValueID> output) const override;
+
+  // Sets the value id at a given position.
+  void set(const size_t index, const ValueID value_id) override;
+
+  // Returns the number of values.
+  size_t size() const override;
+
+  // Returns the number of bytes needed to hold the biggest value id, i.e., the bit width rounded up to whole bytes.
+  AttributeVectorWidth width() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const override;
+
+  // Returns the number of bits used per value id.
+  uint8_t bit_width() const;
+
+  // Unpacks the BLOCK_SIZE value ids of the given block into output. The last block is padded with zeros.
+  void unpack_block(const size_t block_index, std::span<ValueID, BLOCK_SIZE> output) const;
+
+ private:
+  std::vector<uint64_t> _words;
+  size_t _size;
+  uint8_t _bit_width;
+};
+
+}  // namespace opossum
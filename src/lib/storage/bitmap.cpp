@@ -0,0 +1,159 @@
+#include "bitmap.hpp"
+
+#include <bit>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Bitmap::Bitmap(const size_t size, const bool value) {
+  resize(size, value);
+}
+
+Bitmap::Bitmap(const std::initializer_list<bool> values) {
+  reserve(values.size());
+  for (const auto value : values) {
+    push_back(value);
+  }
+}
+
+void Bitmap::set(const size_t index, const bool value) {
+  DebugAssert(index < _size, "Tried to set bit of Bitmap out of bounds.");
+  const auto mask = uint64_t{1} << (index % WORD_BITS);
+  if (value) {
+    _words[index / WORD_BITS] |= mask;
+  } else {
+    _words[index / WORD_BITS] &= ~mask;
+  }
+}
+
+void Bitmap::push_back(const bool value) {
+  if (_size % WORD_BITS == 0) {
+    _words.push_back(0);
+  }
+  auto word = std::atomic_ref(_words.back());
+  word.store(word.load(std::memory_order_relaxed) | static_cast<uint64_t>(value) << (_size % WORD_BITS),
+             std::memory_order_relaxed);
+  // Readers only access the new bit after they have loaded the new size.
+  std::atomic_ref(_size).store(_size + 1, std::memory_order_release);
+}
+
+void Bitmap::resize(const size_t size, const bool value) {
+  const auto old_size = _size;
+  _size = size;
+  if (size < old_size) {
+    _words.resize((size + WORD_BITS - 1) / WORD_BITS);
+    _clear_unused_bits();
+    return;
+  }
+
+  if (value && old_size % WORD_BITS != 0) {
+    _words.back() |= ~uint64_t{0} << (old_size % WORD_BITS);
+  }
+  _words.resize((size + WORD_BITS - 1) / WORD_BITS, value ? ~uint64_t{0} : uint64_t{0});
+  _clear_unused_bits();
+}
+
+void Bitmap::reserve(const size_t size) {
+  _words.reserve((size + WORD_BITS - 1) / WORD_BITS);
+}
+
+size_t Bitmap::size() const {
+  return std::atomic_ref(const_cast<size_t&>(_size)).load(std::memory_order_acquire);
+}
+
+bool Bitmap::empty() const {
+  return size() == 0;
+}
+
+size_t Bitmap::word_count() const {
+  return _words.size();
+}
+
+size_t Bitmap::count() const {
+  auto count = size_t{0};
+  for (const auto word : _words.span()) {
+    count += std::popcount(word);
+  }
+  return count;
+}
+
+size_t Bitmap::find_next_set(const size_t begin) const {
+  const auto size = this->size();
+  if (begin >= size) {
+    return size;
+  }
+
+  auto word_index = begin / WORD_BITS;
+  // Bits before begin are masked out of the first word.
+  auto word = this->word(word_index) & (~uint64_t{0} << (begin % WORD_BITS));
+  while (word == 0) {
+    ++word_index;
+    if (word_index * WORD_BITS >= size) {
+      return size;
+    }
+    word = this->word(word_index);
+  }
+  return std::min(word_index * WORD_BITS + std::countr_zero(word), size);
+}
+
+size_t Bitmap::find_next_unset(const size_t begin) const {
+  const auto size = this->size();
+  if (begin >= size) {
+    return size;
+  }
+
+  auto word_index = begin / WORD_BITS;
+  auto word = ~this->word(word_index) & (~uint64_t{0} << (begin % WORD_BITS));
+  while (word == 0) {
+    ++word_index;
+    if (word_index * WORD_BITS >= size) {
+      return size;
+    }
+    word = ~this->word(word_index);
+  }
+  // Unused bits of the last word are zero and would be found as unset.
+  return std::min(word_index * WORD_BITS + std::countr_zero(word), size);
+}
+
+Bitmap& Bitmap::operator&=(const Bitmap& other) {
+  Assert(_size == other._size, "Tried to combine Bitmaps of different sizes.");
+  auto* const words = _words.data();
+  const auto* const other_words = other._words.data();
+  for (auto word_index = size_t{0}, word_count = _words.size(); word_index < word_count; ++word_index) {
+    words[word_index] &= other_words[word_index];
+  }
+  return *this;
+}
+
+Bitmap& Bitmap::operator|=(const Bitmap& other) {
+  Assert(_size == other._size, "Tried to combine Bitmaps of different sizes.");
+  auto* const words = _words.data();
+  const auto* const other_words = other._words.data();
+  for (auto word_index = size_t{0}, word_count = _words.size(); word_index < word_count; ++word_index) {
+    words[word_index] |= other_words[word_index];
+  }
+  return *this;
+}
+
+Bitmap& Bitmap::and_not(const Bitmap& other) {
+  Assert(_size == other._size, "Tried to combine Bitmaps of different sizes.");
+  auto* const words = _words.data();
+  const auto* const other_words = other._words.data();
+  for (auto word_index = size_t{0}, word_count = _words.size(); word_index < word_count; ++word_index) {
+    words[word_index] &= ~other_words[word_index];
+  }
+  return *this;
+}
+
+size_t Bitmap::estimate_memory_usage() const {
+  return _words.size() * sizeof(uint64_t);
+}
+
+void Bitmap::_clear_unused_bits() {
+  if (_size % WORD_BITS != 0) {
+    _words.back() &= ~uint64_t{0} >> (WORD_BITS - _size % WORD_BITS);
+  }
+}
+
+}  // namespace opossum
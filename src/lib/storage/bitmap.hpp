@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+
+#include "stable_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Bitmap is a packed vector of bits stored in 64-bit words. Segments use it to mark NULL values. In contrast to
+// std::vector<bool>, it exposes its words so that operators can process 64 rows at once, e.g., to skip words without
+// NULL values or to combine NULL values with selections. Bits after size() are always zero.
+//
+// The words are stored in a StableVector, and push_back as well as the accessors for single bits and words access the
+// words and the size atomically. Thus, the NULL values of a mutable segment can be read while rows are appended, as
+// long as readers only access bits that were appended before they read the segment's size.
+class Bitmap {
+ public:
+  static constexpr auto WORD_BITS = size_t{64};
+
+  Bitmap() = default;
+  explicit Bitmap(const size_t size, const bool value = false);
+  Bitmap(const std::initializer_list<bool> values);
+
+  // Returns the bit at a given position.
+  bool operator[](const size_t index) const {
+    DebugAssert(index < size(), "Tried to access Bitmap out of bounds.");
+    return (word(index / WORD_BITS) >> (index % WORD_BITS)) & 1;
+  }
+
+  // Sets the bit at a given position.
+  void set(const size_t index, const bool value = true);
+
+  // Appends a bit.
+  void push_back(const bool value);
+
+  // Resizes the bitmap. New bits are set to value.
+  void resize(const size_t size, const bool value = false);
+
+  void reserve(const size_t size);
+
+  // Returns the number of bits.
+  size_t size() const;
+
+  bool empty() const;
+
+  // Returns the word holding the bits from word_index * WORD_BITS to (word_index + 1) * WORD_BITS - 1. The least
+  // significant bit of the word is the first bit.
+  uint64_t word(const size_t word_index) const {
+    // push_back may update the last word concurrently.
+    return std::atomic_ref(const_cast<uint64_t&>(_words[word_index])).load(std::memory_order_relaxed);
+  }
+
+  // Returns the number of words.
+  size_t word_count() const;
+
+  // Returns the number of set bits.
+  size_t count() const;
+
+  // Returns the position of the first set or unset bit at or after begin, or size() if there is none.
+  size_t find_next_set(const size_t begin) const;
+  size_t find_next_unset(const size_t begin) const;
+
+  // Combine two bitmaps of the same size bitwise. and_not keeps the bits that are not set in other, e.g., to remove
+  // NULL values from a selection.
+  Bitmap& operator&=(const Bitmap& other);
+  Bitmap& operator|=(const Bitmap& other);
+  Bitmap& and_not(const Bitmap& other);
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+  friend bool operator==(const Bitmap& lhs, const Bitmap& rhs) = default;
+
+ protected:
+  // Clears the bits after size() in the last word.
+  void _clear_unused_bits();
+
+  StableVector<uint64_t> _words;
+  size_t _size{0};
+};
+
+}  // namespace opossum
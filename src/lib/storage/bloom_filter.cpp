@@ -0,0 +1,72 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// std::hash is the identity for integers in libstdc++, so the hash is mixed with MurmurHash3's finalizer before its
+// bits are used.
+uint64_t mix(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// Calls functor with the bit position of each hash function. The positions are derived from the two halves of the
+// mixed hash (double hashing), so that the value is hashed only once.
+template <typename Functor>
+void for_each_position(const size_t hash, const uint8_t hash_count, const size_t bit_count, const Functor& functor) {
+  const auto mixed_hash = mix(hash);
+  const auto first_hash = mixed_hash & 0xFFFFFFFF;
+  const auto second_hash = (mixed_hash >> 32) | 1;
+  for (auto hash_index = uint64_t{0}; hash_index < hash_count; ++hash_index) {
+    if (!functor((first_hash + hash_index * second_hash) % bit_count)) {
+      return;
+    }
+  }
+}
+
+}  // namespace
+
+BloomFilter::BloomFilter(const size_t value_count, const size_t bits_per_value)
+    : _bits(std::max(value_count * bits_per_value, Bitmap::WORD_BITS)),
+      // The false positive rate is minimal for bits_per_value * ln(2) hash functions.
+      _hash_count{static_cast<uint8_t>(std::clamp(std::round(static_cast<double>(bits_per_value) * std::numbers::ln2),
+                                                  1.0, 16.0))} {
+  Assert(bits_per_value > 0, "Bloom filter needs at least one bit per value.");
+}
+
+void BloomFilter::_insert_hash(const size_t hash) {
+  for_each_position(hash, _hash_count, _bits.size(), [&](const size_t position) {
+    _bits.set(position);
+    return true;
+  });
+}
+
+bool BloomFilter::_may_contain_hash(const size_t hash) const {
+  auto contained = true;
+  for_each_position(hash, _hash_count, _bits.size(), [&](const size_t position) {
+    contained = _bits[position];
+    return contained;
+  });
+  return contained;
+}
+
+uint8_t BloomFilter::hash_count() const {
+  return _hash_count;
+}
+
+size_t BloomFilter::estimate_memory_usage() const {
+  return _bits.estimate_memory_usage();
+}
+
+}  // namespace opossum
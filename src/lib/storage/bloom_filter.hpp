@@ -0,0 +1,47 @@
+#pragma once
+
+#include <functional>
+
+#include "bitmap.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// A Bloom filter tells whether a segment may contain a value, which allows equality scans to skip segments without
+// touching their rows (see Table::use_bloom_filter). Contained values are always found, but values that are not
+// contained are reported as contained with a small probability (about 1% with the default of 10 bits per value). Values
+// are hashed with std::hash, so that they have to be looked up with the column's type.
+class BloomFilter : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_BITS_PER_VALUE = size_t{10};
+
+  // Creates an empty filter that is sized for the given number of distinct values.
+  explicit BloomFilter(const size_t value_count, const size_t bits_per_value = DEFAULT_BITS_PER_VALUE);
+
+  // Adds a value to the filter. Not thread-safe.
+  template <typename T>
+  void insert(const T& value) {
+    _insert_hash(std::hash<T>{}(value));
+  }
+
+  // Returns false if the value is definitely not contained and true if it may be contained.
+  template <typename T>
+  bool may_contain(const T& value) const {
+    return _may_contain_hash(std::hash<T>{}(value));
+  }
+
+  // Returns the number of hash functions, i.e., the number of bits that are checked per lookup.
+  uint8_t hash_count() const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  void _insert_hash(const size_t hash);
+  bool _may_contain_hash(const size_t hash) const;
+
+  Bitmap _bits;
+  uint8_t _hash_count;
+};
+
+}  // namespace opossum
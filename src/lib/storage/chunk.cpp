@@ -3,44 +3,72 @@
 #include "abstract_segment.hpp"
 #include "all_type_variant.hpp"
 #include "chunk.hpp"
+#include "column_batch.hpp"
+#include "mvcc_data.hpp"
+#include "unsorted_dictionary_segment.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
-void Chunk::add_segment(const std::shared_ptr<AbstractSegment> segment) {
+void Chunk::add_segment(const std::shared_ptr<AbstractSegment> segment,
+                        const std::shared_ptr<AbstractZoneMap>& zone_map,
+                        const std::shared_ptr<const BloomFilter>& bloom_filter) {
   // FIXME: shared_ptr is copied each time, we could remove the `const` and would technically not change the
   //        interface, but not sure if upstream is okay with that
   _segments.emplace_back(segment);
+  _zone_maps.emplace_back(zone_map);
+  _bloom_filters.emplace_back(bloom_filter);
+  _sort_modes.emplace_back(std::nullopt);
 }
 
 template <typename T>
-static bool try_to_append_to_concrete_value_segment(AbstractSegment* segment, const AllTypeVariant& value) {
-  const auto concrete_value_segment = dynamic_cast<ValueSegment<T>*>(segment);
-  if (!concrete_value_segment) {
-    return false;
+static bool try_to_append_to_concrete_segment(AbstractSegment* segment, AbstractZoneMap* zone_map,
+                                              const AllTypeVariant& value) {
+  // The zone map is updated with the value as stored by the segment, i.e., after it has been cast to T.
+  const auto append = [&](auto& concrete_segment) {
+    concrete_segment.append(value);
+    if (zone_map) {
+      static_cast<ZoneMap<T>&>(*zone_map).append(concrete_segment.get_typed_value(concrete_segment.size() - 1));
+    }
+  };
+
+  if (const auto concrete_value_segment = dynamic_cast<ValueSegment<T>*>(segment)) {
+    append(*concrete_value_segment);
+    return true;
+  }
+  if (const auto concrete_unsorted_dictionary_segment = dynamic_cast<UnsortedDictionarySegment<T>*>(segment)) {
+    append(*concrete_unsorted_dictionary_segment);
+    return true;
   }
-  concrete_value_segment->append(value);
-  return true;
+  return false;
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert(values.size() == _segments.size(), "Tried to append row with unfitting number of columns.");
 
-  for (auto segment_index = size_t{0}, size = values.size(); segment_index < size; ++segment_index) {
-    // Try all possible instantiations of `ValueSegment`, because we cannot know which subclass is inside the
-    // `AbstractSegment` and still want to use the casting functionality of `ValueSegment`, that is, we cannot assume
-    // that the type of `value` matches this segment.
+  // Readers may access the rows before size() without locks. Thus, the row's versioning information is added first
+  // and the first segment, which determines size(), is appended to last.
+  if (_mvcc_data) {
+    _mvcc_data->grow(size() + 1);
+  }
+
+  for (auto segment_index = values.size(); segment_index-- > 0;) {
+    // Try all possible instantiations of `ValueSegment` and `UnsortedDictionarySegment`, because we cannot know which
+    // subclass is inside the `AbstractSegment` and still want to use the casting functionality of the segments, that
+    // is, we cannot assume that the type of `value` matches this segment.
 
     const auto& segment = _segments[segment_index];
+    const auto& zone_map = _zone_maps[segment_index];
     const auto& value = values[segment_index];
 
-#define TRY_WITH_TYPE(_, __, type)                                                                 \
-  {                                                                                                \
-    const bool type_matched = try_to_append_to_concrete_value_segment<type>(segment.get(), value); \
-    if (type_matched) {                                                                            \
-      continue;                                                                                    \
-    }                                                                                              \
+#define TRY_WITH_TYPE(_, __, type)                                                                           \
+  {                                                                                                          \
+    const bool type_matched = try_to_append_to_concrete_segment<type>(segment.get(), zone_map.get(), value); \
+    if (type_matched) {                                                                                      \
+      continue;                                                                                              \
+    }                                                                                                        \
   }
     BOOST_PP_SEQ_FOR_EACH(TRY_WITH_TYPE, _, data_types_macro);
 #undef TRY_WITH_TYPE
@@ -49,10 +77,48 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
+void Chunk::append_columns(const std::vector<std::shared_ptr<const AbstractColumnBatch>>& column_batches,
+                           const size_t begin, const size_t end) {
+  DebugAssert(column_batches.size() == _segments.size(), "Tried to append columns with unfitting number of columns.");
+
+  // Like in append, the versioning information is added first and the first segment is appended to last.
+  if (_mvcc_data) {
+    _mvcc_data->grow(static_cast<ChunkOffset>(size() + end - begin));
+  }
+
+  for (auto column_id = column_batches.size(); column_id-- > 0;) {
+    column_batches[column_id]->append_to(*_segments[column_id], _zone_maps[column_id].get(), begin, end);
+  }
+}
+
 std::shared_ptr<AbstractSegment> Chunk::get_segment(const ColumnID column_id) const {
   return _segments.at(column_id);
 }
 
+std::shared_ptr<AbstractZoneMap> Chunk::get_zone_map(const ColumnID column_id) const {
+  return _zone_maps.at(column_id);
+}
+
+std::shared_ptr<const BloomFilter> Chunk::get_bloom_filter(const ColumnID column_id) const {
+  return _bloom_filters.at(column_id);
+}
+
+void Chunk::set_sort_mode(const ColumnID column_id, const SortMode sort_mode) {
+  _sort_modes.at(column_id) = sort_mode;
+}
+
+std::optional<SortMode> Chunk::sort_mode(const ColumnID column_id) const {
+  return _sort_modes.at(column_id);
+}
+
+void Chunk::set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data) {
+  _mvcc_data = mvcc_data;
+}
+
+std::shared_ptr<MvccData> Chunk::mvcc_data() const {
+  return _mvcc_data;
+}
+
 ColumnCount Chunk::column_count() const {
   return static_cast<ColumnCount>(_segments.size());
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
@@ -8,7 +9,11 @@
 namespace opossum {
 
 class BaseIndex;
+class AbstractColumnBatch;
 class AbstractSegment;
+class AbstractZoneMap;
+class BloomFilter;
+class MvccData;
 
 // A chunk is a horizontal partition of a table. For each column in the table, it holds one segment. The segments
 // across all chunks constitute the column.
@@ -19,8 +24,11 @@ class Chunk : private Noncopyable {
   // Creates an empty chunk.
   Chunk() = default;
 
-  // Adds a segment to the "right" of the chunk.
-  void add_segment(const std::shared_ptr<AbstractSegment> segment);
+  // Adds a segment to the "right" of the chunk. The optional zone map has to match the segment's data type and is
+  // updated when rows are appended. The optional Bloom filter has to contain all values of the segment.
+  void add_segment(const std::shared_ptr<AbstractSegment> segment,
+                   const std::shared_ptr<AbstractZoneMap>& zone_map = nullptr,
+                   const std::shared_ptr<const BloomFilter>& bloom_filter = nullptr);
 
   // Returns the number of columns (cannot exceed ColumnID (uint16_t)).
   ColumnCount column_count() const;
@@ -29,14 +37,46 @@ class Chunk : private Noncopyable {
   ChunkOffset size() const;
 
   // Adds a new row, given as a list of values, to the chunk. Note this is slow and not thread-safe and should be used
-  // for testing purposes only.
+  // for testing purposes only. If the chunk has MvccData, the row is added as uncommitted. Concurrent readers may
+  // access the rows before size(), but not the zone maps.
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Appends the rows [begin, end) of the column batches, one per column, to the chunk's segments and zone maps. The
+  // batches' types have to match the columns' data types. Like append, the rows are added as uncommitted. Not
+  // thread-safe.
+  void append_columns(const std::vector<std::shared_ptr<const AbstractColumnBatch>>& column_batches, const size_t begin,
+                      const size_t end);
+
   // Returns the segment at a given position.
   std::shared_ptr<AbstractSegment> get_segment(ColumnID column_id) const;
 
+  // Returns the zone map of the segment at a given position or nullptr if the segment has none.
+  std::shared_ptr<AbstractZoneMap> get_zone_map(ColumnID column_id) const;
+
+  // Returns the Bloom filter of the segment at a given position or nullptr if the segment has none.
+  std::shared_ptr<const BloomFilter> get_bloom_filter(ColumnID column_id) const;
+
+  // Records that the segment at a given position is sorted, e.g., when it was detected during compression or the data
+  // is known to be sorted. Scans use binary search on sorted segments. Must not be set for segments that are still
+  // appended to or after the chunk has been shared with readers.
+  void set_sort_mode(ColumnID column_id, const SortMode sort_mode);
+
+  // Returns the order of the segment at a given position or std::nullopt if the segment is not known to be sorted.
+  std::optional<SortMode> sort_mode(ColumnID column_id) const;
+
+  // Sets the versioning information of the chunk's rows, which is grown when rows are appended. Chunks of tables have
+  // MvccData, chunks created by operators usually do not.
+  void set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data);
+
+  // Returns the versioning information of the chunk's rows or nullptr if all rows are visible to all transactions.
+  std::shared_ptr<MvccData> mvcc_data() const;
+
  protected:
   std::vector<std::shared_ptr<AbstractSegment>> _segments;
+  std::vector<std::shared_ptr<AbstractZoneMap>> _zone_maps;
+  std::vector<std::shared_ptr<const BloomFilter>> _bloom_filters;
+  std::vector<std::optional<SortMode>> _sort_modes;
+  std::shared_ptr<MvccData> _mvcc_data;
 };
 
 }  // namespace opossum
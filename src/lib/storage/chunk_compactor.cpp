@@ -0,0 +1,29 @@
+#include "chunk_compactor.hpp"
+
+#include "table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkCompactor::ChunkCompactor(const std::shared_ptr<Table>& table, const std::chrono::milliseconds interval,
+                               const double invalidated_fraction_threshold, const SegmentEncodingSpec& encoding_spec)
+    : _table{table}, _invalidated_fraction_threshold{invalidated_fraction_threshold}, _encoding_spec{encoding_spec} {
+  Assert(_table, "ChunkCompactor requires a table.");
+  Assert(invalidated_fraction_threshold > 0.0 && invalidated_fraction_threshold <= 1.0,
+         "Invalidated fraction threshold must be in (0, 1].");
+  _periodic_task = std::make_unique<PeriodicTask>(interval, [this]() { _compact(); });
+}
+
+void ChunkCompactor::compact_now() {
+  _periodic_task->run_now();
+}
+
+size_t ChunkCompactor::compacted_chunk_count() const {
+  return _compacted_chunk_count;
+}
+
+void ChunkCompactor::_compact() {
+  _compacted_chunk_count += _table->compact_chunks(_invalidated_fraction_threshold, _encoding_spec).size();
+}
+
+}  // namespace opossum
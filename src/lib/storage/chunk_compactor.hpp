@@ -0,0 +1,41 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "types.hpp"
+#include "utils/periodic_task.hpp"
+
+namespace opossum {
+
+class Table;
+
+// ChunkCompactor periodically rewrites the chunks of a table in which at least the given fraction of rows is
+// invalidated (see Table::compact_chunks) in a background thread. The thread is stopped when the compactor is
+// destroyed.
+class ChunkCompactor : private Noncopyable {
+ public:
+  ChunkCompactor(const std::shared_ptr<Table>& table, const std::chrono::milliseconds interval,
+                 const double invalidated_fraction_threshold = 0.5,
+                 const SegmentEncodingSpec& encoding_spec = SegmentEncodingSpec{});
+
+  // Compacts the table right away instead of waiting for the interval to elapse. Blocks until the compaction is done.
+  void compact_now();
+
+  // Returns the number of chunks rewritten so far.
+  size_t compacted_chunk_count() const;
+
+ protected:
+  void _compact();
+
+  std::shared_ptr<Table> _table;
+  double _invalidated_fraction_threshold;
+  SegmentEncodingSpec _encoding_spec;
+  std::atomic<size_t> _compacted_chunk_count{0};
+
+  // Declared last, so that the background thread is stopped before the other members are destroyed.
+  std::unique_ptr<PeriodicTask> _periodic_task;
+};
+
+}  // namespace opossum
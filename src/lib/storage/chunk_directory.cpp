@@ -0,0 +1,81 @@
+#include "chunk_directory.hpp"
+
+#include <bit>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkDirectory::~ChunkDirectory() {
+  for (auto& block : _blocks) {
+    delete[] block.load();
+  }
+}
+
+ChunkID ChunkDirectory::size() const {
+  // Synchronizes with the release store in append, so that the published slots are visible.
+  return ChunkID{_size.load(std::memory_order_acquire)};
+}
+
+std::shared_ptr<Chunk> ChunkDirectory::get(const ChunkID chunk_id) const {
+  Assert(chunk_id < size(), "Tried to access a non-existent chunk.");
+  return _slot(chunk_id).chunk.load();
+}
+
+bool ChunkDirectory::is_mutable(const ChunkID chunk_id) const {
+  Assert(chunk_id < size(), "Tried to access a non-existent chunk.");
+  return _slot(chunk_id).is_mutable.load();
+}
+
+PartitionID ChunkDirectory::partition_id(const ChunkID chunk_id) const {
+  Assert(chunk_id < size(), "Tried to access a non-existent chunk.");
+  return _slot(chunk_id).partition_id;
+}
+
+ChunkID ChunkDirectory::append(std::shared_ptr<Chunk> chunk, const bool is_mutable, const PartitionID partition_id) {
+  const auto chunk_id = ChunkID{_size.load(std::memory_order_relaxed)};
+  Assert(chunk_id != INVALID_CHUNK_ID, "Chunk directory is full.");
+
+  const auto index = uint64_t{chunk_id} + FIRST_BLOCK_SIZE;
+  const auto block_index = std::bit_width(index) - 1 - FIRST_BLOCK_SIZE_BITS;
+  if (!_blocks[block_index].load(std::memory_order_relaxed)) {
+    // The block is published together with the chunk by the release store of the size below.
+    _blocks[block_index].store(new Slot[FIRST_BLOCK_SIZE << block_index], std::memory_order_relaxed);
+  }
+
+  auto& slot = _slot(chunk_id);
+  slot.chunk.store(std::move(chunk));
+  slot.is_mutable.store(is_mutable);
+  slot.partition_id = partition_id;
+  _size.store(chunk_id + 1, std::memory_order_release);
+  return chunk_id;
+}
+
+void ChunkDirectory::replace(const ChunkID chunk_id, std::shared_ptr<Chunk> chunk) {
+  Assert(chunk_id < size(), "Tried to replace a non-existent chunk.");
+  _slot(chunk_id).chunk.store(std::move(chunk));
+}
+
+void ChunkDirectory::set_immutable(const ChunkID chunk_id) {
+  Assert(chunk_id < size(), "Tried to access a non-existent chunk.");
+  _slot(chunk_id).is_mutable.store(false);
+}
+
+void ChunkDirectory::clear() {
+  const auto size = this->size();
+  _size.store(0);
+  for (auto chunk_id = ChunkID{0}; chunk_id < size; ++chunk_id) {
+    _slot(chunk_id).chunk.store(nullptr);
+  }
+}
+
+ChunkDirectory::Slot& ChunkDirectory::_slot(const ChunkID chunk_id) const {
+  // Block i starts at index FIRST_BLOCK_SIZE * (2^i - 1). Thus, the block of an index is given by the highest set bit
+  // of index + FIRST_BLOCK_SIZE.
+  const auto index = uint64_t{chunk_id} + FIRST_BLOCK_SIZE;
+  const auto block_index = std::bit_width(index) - 1 - FIRST_BLOCK_SIZE_BITS;
+  const auto block_offset = index - (FIRST_BLOCK_SIZE << block_index);
+  return _blocks[block_index].load(std::memory_order_relaxed)[block_offset];
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include "chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The chunk directory is the list of a table's chunks. Next to each chunk, it stores whether rows can still be appended
+// to the chunk and the partition that the chunk belongs to. The directory only grows at the end. Its slots are
+// allocated in blocks of doubling size that are never moved, so that readers can access chunks without locks while
+// writers add chunks. Each slot holds its chunk in an std::atomic<std::shared_ptr>, so that replacing a chunk neither
+// races with readers nor needs a lock shared with other slots. A new chunk is only published (i.e., counted by size())
+// after its slot has been written.
+// Writers, i.e., append, replace, set_immutable, and clear, have to be serialized by the caller (see
+// Table::_chunk_mutex). clear must not run concurrently with readers.
+class ChunkDirectory : private Noncopyable {
+ public:
+  ChunkDirectory() = default;
+
+  ~ChunkDirectory();
+
+  // Returns the number of published chunks.
+  ChunkID size() const;
+
+  // Returns the chunk with the given id.
+  std::shared_ptr<Chunk> get(const ChunkID chunk_id) const;
+
+  // Returns whether rows can be appended to the chunk.
+  bool is_mutable(const ChunkID chunk_id) const;
+
+  // Returns the partition that the chunk belongs to.
+  PartitionID partition_id(const ChunkID chunk_id) const;
+
+  // Adds the chunk at the end and publishes it. Returns its id.
+  ChunkID append(std::shared_ptr<Chunk> chunk, const bool is_mutable, const PartitionID partition_id);
+
+  // Atomically replaces the chunk with the given id, which readers see either before or after.
+  void replace(const ChunkID chunk_id, std::shared_ptr<Chunk> chunk);
+
+  // Marks the chunk as immutable.
+  void set_immutable(const ChunkID chunk_id);
+
+  // Removes all chunks. The allocated blocks are kept for chunks appended later on.
+  void clear();
+
+ protected:
+  struct Slot {
+    std::atomic<std::shared_ptr<Chunk>> chunk;
+    std::atomic<bool> is_mutable{false};
+    PartitionID partition_id{0};
+  };
+
+  // Block i holds FIRST_BLOCK_SIZE * 2^i slots, which suffices for all ChunkIDs with BLOCK_COUNT blocks.
+  static constexpr auto FIRST_BLOCK_SIZE_BITS = 6;
+  static constexpr auto FIRST_BLOCK_SIZE = uint64_t{1} << FIRST_BLOCK_SIZE_BITS;
+  static constexpr auto BLOCK_COUNT = size_t{sizeof(ChunkID::base_type) * 8 - FIRST_BLOCK_SIZE_BITS + 1};
+
+  Slot& _slot(const ChunkID chunk_id) const;
+
+  std::array<std::atomic<Slot*>, BLOCK_COUNT> _blocks{};
+  std::atomic<ChunkID::base_type> _size{0};
+};
+
+}  // namespace opossum
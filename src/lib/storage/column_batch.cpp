@@ -0,0 +1,64 @@
+#include "column_batch.hpp"
+
+#include "unsorted_dictionary_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+#include "zone_map.hpp"
+
+namespace opossum {
+
+template <typename T>
+ColumnBatch<T>::ColumnBatch(const std::span<const T> values, const Bitmap* null_values)
+    : _values{values}, _null_values{null_values} {
+  Assert(!null_values || null_values->size() == values.size(), "NULL bitmap has to have one bit per value.");
+}
+
+template <typename T>
+size_t ColumnBatch<T>::size() const {
+  return _values.size();
+}
+
+template <typename T>
+bool ColumnBatch<T>::is_null(const size_t row_index) const {
+  return _null_values && (*_null_values)[row_index];
+}
+
+template <typename T>
+AllTypeVariant ColumnBatch<T>::operator[](const size_t row_index) const {
+  if (is_null(row_index)) {
+    return NULL_VALUE;
+  }
+  return _values[row_index];
+}
+
+template <typename T>
+void ColumnBatch<T>::append_to(AbstractSegment& segment, AbstractZoneMap* zone_map, const size_t begin,
+                               const size_t end) const {
+  DebugAssert(begin <= end && end <= size(), "Tried to append rows that are not in the column batch.");
+  const auto values = _values.subspan(begin, end - begin);
+  if (auto* const value_segment = dynamic_cast<ValueSegment<T>*>(&segment)) {
+    value_segment->append(values, _null_values, begin);
+  } else if (auto* const unsorted_dictionary_segment = dynamic_cast<UnsortedDictionarySegment<T>*>(&segment)) {
+    unsorted_dictionary_segment->append(values, _null_values, begin);
+  } else {
+    Fail("Column batches can only be appended to ValueSegments or UnsortedDictionarySegments of the same type.");
+  }
+
+  if (zone_map) {
+    static_cast<ZoneMap<T>&>(*zone_map).append(values, _null_values, begin);
+  }
+}
+
+template <typename T>
+std::span<const T> ColumnBatch<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const Bitmap* ColumnBatch<T>::null_values() const {
+  return _null_values;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnBatch);
+
+}  // namespace opossum
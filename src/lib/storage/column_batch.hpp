@@ -0,0 +1,64 @@
+#pragma once
+
+#include <span>
+
+#include "all_type_variant.hpp"
+#include "bitmap.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+class AbstractZoneMap;
+
+// A column batch holds the values of one column for a number of rows, which Table::append_columns adds to the table at
+// once. In contrast to appending rows of AllTypeVariants, the values are copied into the segments without casting
+// them, so that the batch's type has to match the column's data type. The batch does not own the values and the
+// optional NULL bitmap, which thus have to outlive it. If the bit of a row is set in the NULL bitmap, the row is NULL
+// and its entry in the values is ignored.
+class AbstractColumnBatch : private Noncopyable {
+ public:
+  virtual ~AbstractColumnBatch() = default;
+
+  // Returns the number of rows.
+  virtual size_t size() const = 0;
+
+  // Returns whether a row is NULL.
+  virtual bool is_null(const size_t row_index) const = 0;
+
+  // Returns the value of a row. If you want to write efficient code, back off!
+  virtual AllTypeVariant operator[](const size_t row_index) const = 0;
+
+  // Appends the rows [begin, end) to a ValueSegment or UnsortedDictionarySegment of the batch's type and to its zone
+  // map (if given).
+  virtual void append_to(AbstractSegment& segment, AbstractZoneMap* zone_map, const size_t begin,
+                         const size_t end) const = 0;
+};
+
+template <typename T>
+class ColumnBatch : public AbstractColumnBatch {
+ public:
+  explicit ColumnBatch(const std::span<const T> values, const Bitmap* null_values = nullptr);
+
+  size_t size() const final;
+
+  bool is_null(const size_t row_index) const final;
+
+  AllTypeVariant operator[](const size_t row_index) const final;
+
+  void append_to(AbstractSegment& segment, AbstractZoneMap* zone_map, const size_t begin,
+                 const size_t end) const final;
+
+  std::span<const T> values() const;
+
+  // Returns the NULL bitmap or nullptr if no row is NULL.
+  const Bitmap* null_values() const;
+
+ protected:
+  const std::span<const T> _values;
+  const Bitmap* const _null_values;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(ColumnBatch);
+
+}  // namespace opossum
@@ -0,0 +1,188 @@
+#include "delta_encoded_segment.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Zigzag encoding maps signed deltas to unsigned integers so that small negative deltas stay small (0, -1, 1, -2, ...
+// become 0, 1, 2, 3, ...). All arithmetic is done unsigned, i.e., modulo 2^n, so that it never overflows.
+template <typename UnsignedT>
+UnsignedT zigzag_encode(const UnsignedT delta) {
+  constexpr auto sign_shift = std::numeric_limits<UnsignedT>::digits - 1;
+  return static_cast<UnsignedT>(delta << 1) ^ static_cast<UnsignedT>(UnsignedT{0} - (delta >> sign_shift));
+}
+
+template <typename UnsignedT>
+UnsignedT zigzag_decode(const UnsignedT encoded_delta) {
+  return static_cast<UnsignedT>(encoded_delta >> 1) ^ static_cast<UnsignedT>(UnsignedT{0} - (encoded_delta & 1));
+}
+
+}  // namespace
+
+template <std::integral T>
+DeltaEncodedSegment<T>::DeltaEncodedSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
+  Assert(value_segment, "Tried to create DeltaEncodedSegment<T> from abstract segment that was not ValueSegment<T>.");
+  _is_nullable = value_segment->is_nullable();
+
+  // NULL values are replaced by their predecessor. Leading NULL values are replaced by the first non-NULL value.
+  const auto& values = value_segment->values();
+  const auto size = static_cast<ChunkOffset>(values.size());
+  auto filled_values = std::vector<T>(size);
+  auto previous_value = std::optional<T>{};
+  auto first_value_offset = ChunkOffset{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    if (!value_segment->is_null(chunk_offset)) {
+      previous_value = values[chunk_offset];
+    } else if (!previous_value) {
+      first_value_offset = chunk_offset + 1;
+    }
+    filled_values[chunk_offset] = previous_value.value_or(T{0});
+  }
+  if (first_value_offset < size) {
+    std::fill_n(filled_values.begin(), first_value_offset, filled_values[first_value_offset]);
+  }
+
+  _is_sorted = std::is_sorted(filled_values.begin(), filled_values.end());
+
+  // First pass: compute the deltas and the largest one. The first value of each block has no delta.
+  auto deltas = std::vector<UnsignedT>(size);
+  auto max_delta = UnsignedT{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    if (chunk_offset % BLOCK_SIZE == 0) {
+      _checkpoints.emplace_back(filled_values[chunk_offset]);
+      continue;
+    }
+    const auto delta = static_cast<UnsignedT>(static_cast<UnsignedT>(filled_values[chunk_offset]) -
+                                              static_cast<UnsignedT>(filled_values[chunk_offset - 1]));
+    deltas[chunk_offset] = _is_sorted ? delta : zigzag_encode(delta);
+    max_delta = std::max(max_delta, deltas[chunk_offset]);
+  }
+
+  Assert(max_delta <= std::numeric_limits<ValueID::base_type>::max(),
+         "Cannot create DeltaEncodedSegment for values whose differences do not fit into 32 bits.");
+  const auto bit_width = std::max(static_cast<uint8_t>(std::bit_width(max_delta)), uint8_t{1});
+  _deltas = std::make_shared<BitPackedIntegerVector>(size, bit_width);
+
+  // Second pass: store the deltas.
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    _deltas->set(chunk_offset, ValueID{static_cast<ValueID::base_type>(deltas[chunk_offset])});
+  }
+
+  if (_is_nullable) {
+    _null_values = value_segment->null_values();
+  }
+}
+
+template <std::integral T>
+AllTypeVariant DeltaEncodedSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (const auto optional_value = get_typed_value(chunk_offset)) {
+    return *optional_value;
+  }
+  return NULL_VALUE;
+}
+
+template <std::integral T>
+bool DeltaEncodedSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return is_nullable() && _null_values[chunk_offset];
+}
+
+template <std::integral T>
+T DeltaEncodedSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  Assert(optional_value.has_value(),
+         "Tried to `.get` value at offset " + std::to_string(chunk_offset) + " that was NULL.");
+  return *optional_value;
+}
+
+template <std::integral T>
+std::optional<T> DeltaEncodedSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  Assert(chunk_offset < size(), "Tried to access DeltaEncodedSegment out of bounds.");
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  // Sum up the deltas between the checkpoint of the block and the requested value.
+  const auto block_begin = chunk_offset - chunk_offset % BLOCK_SIZE;
+  auto value = static_cast<UnsignedT>(_checkpoints[chunk_offset / BLOCK_SIZE]);
+  for (auto delta_offset = block_begin + 1; delta_offset <= chunk_offset; ++delta_offset) {
+    const auto delta = static_cast<UnsignedT>(_deltas->get(delta_offset));
+    value += _is_sorted ? delta : zigzag_decode(delta);
+  }
+  return static_cast<T>(value);
+}
+
+template <std::integral T>
+bool DeltaEncodedSegment<T>::is_sorted() const {
+  return _is_sorted;
+}
+
+template <std::integral T>
+const std::vector<T>& DeltaEncodedSegment<T>::checkpoints() const {
+  return _checkpoints;
+}
+
+template <std::integral T>
+size_t DeltaEncodedSegment<T>::block_count() const {
+  return _checkpoints.size();
+}
+
+template <std::integral T>
+void DeltaEncodedSegment<T>::decode_block(const size_t block_index, std::span<T, BLOCK_SIZE> output) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  Assert(block_index < block_count(), "Tried to decode block of DeltaEncodedSegment out of bounds.");
+  const auto block_begin = static_cast<ChunkOffset>(block_index * BLOCK_SIZE);
+  const auto block_length = std::min(BLOCK_SIZE, size() - block_begin);
+  auto deltas = std::array<ValueID, BLOCK_SIZE>{};
+  _deltas->decode(block_begin, std::span{deltas}.first(block_length));
+
+  auto value = static_cast<UnsignedT>(_checkpoints[block_index]);
+  output[0] = static_cast<T>(value);
+  for (auto index = ChunkOffset{1}; index < block_length; ++index) {
+    const auto delta = static_cast<UnsignedT>(deltas[index]);
+    value += _is_sorted ? delta : zigzag_decode(delta);
+    output[index] = static_cast<T>(value);
+  }
+}
+
+template <std::integral T>
+bool DeltaEncodedSegment<T>::is_nullable() const {
+  return _is_nullable;
+}
+
+template <std::integral T>
+const Bitmap& DeltaEncodedSegment<T>::null_values() const {
+  Assert(is_nullable(), "Tried to get null_values of non-nullable DeltaEncodedSegment.");
+  return _null_values;
+}
+
+template <std::integral T>
+ChunkOffset DeltaEncodedSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_deltas->size());
+}
+
+template <std::integral T>
+size_t DeltaEncodedSegment<T>::estimate_memory_usage() const {
+  return _checkpoints.size() * sizeof(T) + _deltas->estimate_memory_usage() +
+         _null_values.estimate_memory_usage();
+}
+
+template class DeltaEncodedSegment<int8_t>;
+template class DeltaEncodedSegment<int16_t>;
+template class DeltaEncodedSegment<int32_t>;
+template class DeltaEncodedSegment<int64_t>;
+
+}  // namespace opossum
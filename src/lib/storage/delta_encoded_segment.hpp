@@ -0,0 +1,82 @@
+#pragma once
+
+#include <concepts>
+#include <span>
+#include <vector>
+
+#include "abstract_segment.hpp"
+#include "bitmap.hpp"
+#include "bit_packed_integer_vector.hpp"
+
+namespace opossum {
+
+// DeltaEncodedSegment is a specific segment type for integer columns whose values are (almost) sorted, e.g.,
+// auto-increment keys or timestamps in ingestion order. It stores the difference of each value to its predecessor.
+// Every BLOCK_SIZE values, a checkpoint stores the full value so that random accesses only have to sum up the deltas
+// of one block. If the values are sorted, all deltas are non-negative and stored as they are. Otherwise, they are
+// zigzag-encoded. NULL values repeat the value of their predecessor so that they do not break the sort order.
+template <std::integral T>
+class DeltaEncodedSegment : public AbstractSegment {
+ public:
+  // A multiple of BitPackedIntegerVector::BLOCK_SIZE so that blocks can be unpacked without unaligned accesses.
+  static constexpr auto BLOCK_SIZE = ChunkOffset{128};
+
+  /**
+   * Creates a delta-encoded segment from a given value segment. Fails if the difference of two consecutive values
+   * does not fit into 32 bits.
+   */
+  explicit DeltaEncodedSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns whether the non-NULL values are sorted in ascending order.
+  bool is_sorted() const;
+
+  // Returns the first value of each block. NULL values take the value of the previous non-NULL value or, if there is
+  // none, the first non-NULL value of the segment.
+  const std::vector<T>& checkpoints() const;
+
+  // Returns the number of blocks.
+  size_t block_count() const;
+
+  // Decodes the values of the given block into output. NULL values are decoded as described for checkpoints().
+  // Positions after the end of the segment are undefined.
+  void decode_block(const size_t block_index, std::span<T, BLOCK_SIZE> output) const;
+
+  // Returns whether segment supports NULL values.
+  bool is_nullable() const;
+
+  // Returns NULL value bitmap that indicates whether a value is NULL with true at position i. Throws an exception if
+  // is_nullable() returns false.
+  const Bitmap& null_values() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::vector<T> _checkpoints;
+  std::shared_ptr<BitPackedIntegerVector> _deltas;
+  Bitmap _null_values;
+  bool _is_nullable;
+  bool _is_sorted;
+};
+
+extern template class DeltaEncodedSegment<int8_t>;
+extern template class DeltaEncodedSegment<int16_t>;
+extern template class DeltaEncodedSegment<int32_t>;
+extern template class DeltaEncodedSegment<int64_t>;
+
+}  // namespace opossum
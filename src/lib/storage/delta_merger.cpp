@@ -0,0 +1,26 @@
+#include "delta_merger.hpp"
+
+#include "table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+DeltaMerger::DeltaMerger(const std::shared_ptr<Table>& table, const std::chrono::milliseconds interval)
+    : _table{table} {
+  Assert(_table && _table->uses_delta_store(), "DeltaMerger requires a table with delta store.");
+  _periodic_task = std::make_unique<PeriodicTask>(interval, [this]() { _merge(); });
+}
+
+void DeltaMerger::merge_now() {
+  _periodic_task->run_now();
+}
+
+size_t DeltaMerger::merged_chunk_count() const {
+  return _merged_chunk_count;
+}
+
+void DeltaMerger::_merge() {
+  _merged_chunk_count += _table->merge_delta().size();
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "types.hpp"
+#include "utils/periodic_task.hpp"
+
+namespace opossum {
+
+class Table;
+
+// DeltaMerger periodically merges the full delta chunks of a table with a delta store into its main (see
+// Table::merge_delta) in a background thread. The thread is stopped when the merger is destroyed.
+class DeltaMerger : private Noncopyable {
+ public:
+  DeltaMerger(const std::shared_ptr<Table>& table, const std::chrono::milliseconds interval);
+
+  // Merges the delta right away instead of waiting for the interval to elapse. Blocks until the merge is done.
+  void merge_now();
+
+  // Returns the number of chunks merged so far.
+  size_t merged_chunk_count() const;
+
+ protected:
+  void _merge();
+
+  std::shared_ptr<Table> _table;
+  std::atomic<size_t> _merged_chunk_count{0};
+
+  // Declared last, so that the background thread is stopped before the other members are destroyed.
+  std::unique_ptr<PeriodicTask> _periodic_task;
+};
+
+}  // namespace opossum
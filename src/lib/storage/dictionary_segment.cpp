@@ -1,13 +1,17 @@
+#include <algorithm>
 #include <bit>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 
 #include "all_type_variant.hpp"
+#include "bit_packed_integer_vector.hpp"
 #include "dictionary_segment.hpp"
 #include "fixed_width_integer_vector.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
+#include "unsorted_dictionary_segment.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
 
@@ -15,9 +19,14 @@ namespace opossum {
 
 namespace {
 
-std::shared_ptr<AbstractAttributeVector> make_fitting_attribute_vector(size_t size, size_t value_ids_in_use) {
+std::shared_ptr<AbstractAttributeVector> make_fitting_attribute_vector(
+    size_t size, size_t value_ids_in_use, const VectorCompressionType vector_compression_type) {
   const auto bits = std::bit_width(value_ids_in_use);
-  Assert(bits <= 32, "Cannot construct FixedWidthIntegerVector for value ids with more than 32 bits.");
+  Assert(bits <= 32, "Cannot construct attribute vector for value ids with more than 32 bits.");
+  if (vector_compression_type == VectorCompressionType::BitPacking) {
+    // Even a segment with a single distinct value needs one bit per value id.
+    return std::make_shared<BitPackedIntegerVector>(size, std::max(static_cast<uint8_t>(bits), uint8_t{1}));
+  }
   if (bits <= 8) {
     return std::make_shared<FixedWidthIntegerVector<uint8_t>>(size);
   }
@@ -30,13 +39,60 @@ std::shared_ptr<AbstractAttributeVector> make_fitting_attribute_vector(size_t si
 };  // namespace
 
 template <typename T>
-DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment,
+                                        const VectorCompressionType vector_compression_type) {
+  if (const auto unsorted_segment = std::dynamic_pointer_cast<UnsortedDictionarySegment<T>>(abstract_segment)) {
+    // The values of an unsorted dictionary are already distinct. They only have to be sorted, which determines how
+    // their ValueIDs are translated.
+    _is_nullable = unsorted_segment->is_nullable();
+    const auto& unsorted_dictionary = unsorted_segment->dictionary();
+    auto sorted_value_ids = std::vector<ValueID>{};
+    sorted_value_ids.reserve(unsorted_dictionary.size());
+    for (auto value_id = size_t{0}; value_id < unsorted_dictionary.size(); ++value_id) {
+      sorted_value_ids.emplace_back(static_cast<ValueID::base_type>(value_id));
+    }
+    std::ranges::sort(sorted_value_ids, [&](const auto lhs, const auto rhs) {
+      return unsorted_dictionary[lhs] < unsorted_dictionary[rhs];
+    });
+
+    auto dictionary = std::make_shared<Dictionary>();
+    if constexpr (std::is_same_v<T, std::string>) {
+      auto character_count = size_t{0};
+      for (const auto value : unsorted_dictionary) {
+        character_count += value.size();
+      }
+      dictionary->reserve(unsorted_dictionary.size(), character_count);
+    } else {
+      dictionary->reserve(unsorted_dictionary.size());
+    }
+    auto translated_value_ids = std::vector<ValueID>(unsorted_dictionary.size());
+    for (auto value_id = size_t{0}; value_id < sorted_value_ids.size(); ++value_id) {
+      dictionary->emplace_back(unsorted_dictionary[sorted_value_ids[value_id]]);
+      translated_value_ids[sorted_value_ids[value_id]] = ValueID{static_cast<ValueID::base_type>(value_id)};
+    }
+    _dictionary = std::move(dictionary);
+
+    const auto& value_ids = unsorted_segment->value_ids();
+    _attribute_vector = make_fitting_attribute_vector(
+        value_ids.size(), std::max(_dictionary->size() + _is_nullable, size_t{1}) - 1, vector_compression_type);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+      const auto value_id = value_ids[chunk_offset];
+      _attribute_vector->set(chunk_offset, value_id == unsorted_segment->null_value_id()
+                                               ? null_value_id()
+                                               : translated_value_ids[value_id]);
+    }
+    return;
+  }
+
   const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
-  Assert(value_segment, "Tried to create DictionarySegment<T> from abstract segment that was not ValueSegment<T>.");
+  Assert(value_segment,
+         "Tried to create DictionarySegment<T> from abstract segment that was neither ValueSegment<T> nor "
+         "UnsortedDictionarySegment<T>.");
   _is_nullable = value_segment->is_nullable();
 
   const auto& values = value_segment->values();
-  auto value_to_id = std::map<T, ValueID>();
+  // Strings are keyed by the InlineStrings of the value segment to avoid copying them.
+  auto value_to_id = std::map<typename ValueSegment<T>::StoredType, ValueID>();
   for (auto value_index = size_t{0}, size = values.size(); value_index < size; ++value_index) {
     if (!value_segment->is_null(value_index)) {
       value_to_id.emplace(values[value_index], 0);
@@ -48,8 +104,24 @@ DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>&
     value_id = next_value_id++;
   }
 
+  // The dictionary has to be filled before the attribute vector because null_value_id() depends on its size.
+  auto dictionary = std::make_shared<Dictionary>();
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto character_count = size_t{0};
+    for (const auto& [value, value_id] : value_to_id) {
+      character_count += value.size();
+    }
+    dictionary->reserve(value_to_id.size(), character_count);
+  } else {
+    dictionary->reserve(value_to_id.size());
+  }
+  for (const auto& [value, value_id] : value_to_id) {
+    dictionary->emplace_back(value);
+  }
+  _dictionary = std::move(dictionary);
+
   const auto value_ids_in_use = std::max(next_value_id + _is_nullable - 1, 0);
-  _attribute_vector = make_fitting_attribute_vector(values.size(), value_ids_in_use);
+  _attribute_vector = make_fitting_attribute_vector(values.size(), value_ids_in_use, vector_compression_type);
   for (auto value_index = size_t{0}, size = values.size(); value_index < size; ++value_index) {
     if (_is_nullable && value_segment->is_null(value_index)) {
       _attribute_vector->set(value_index, null_value_id());
@@ -57,12 +129,108 @@ DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>&
       _attribute_vector->set(value_index, value_to_id.at(values[value_index]));
     }
   }
+}
 
-  for (auto& [value, value_id] : value_to_id) {
-    _dictionary.emplace_back(std::move(value));
+template <typename T>
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment,
+                                        const std::shared_ptr<const Dictionary>& shared_dictionary,
+                                        const VectorCompressionType vector_compression_type)
+    : _dictionary{shared_dictionary}, _has_shared_dictionary{true} {
+  Assert(_dictionary, "Tried to create DictionarySegment without shared dictionary.");
+  const auto find_value_id = [&](const auto& value) {
+    const auto iterator = std::lower_bound(_dictionary->begin(), _dictionary->end(), value);
+    Assert(iterator != _dictionary->end() && *iterator == value, "Value is not contained in the shared dictionary.");
+    return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary->begin(), iterator))};
+  };
+
+  const auto size = abstract_segment->size();
+  if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment)) {
+    _is_nullable = value_segment->is_nullable();
+    _attribute_vector = make_fitting_attribute_vector(
+        size, std::max(_dictionary->size() + _is_nullable, size_t{1}) - 1, vector_compression_type);
+    const auto& values = value_segment->values();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      const auto is_null = value_segment->is_null(chunk_offset);
+      _attribute_vector->set(chunk_offset, is_null ? null_value_id() : find_value_id(values[chunk_offset]));
+    }
+  } else if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(abstract_segment)) {
+    // The value ids of the other dictionary are translated once, the attribute vector is then rewritten by lookup.
+    _is_nullable = dictionary_segment->null_value_id() != INVALID_VALUE_ID;
+    _attribute_vector = make_fitting_attribute_vector(
+        size, std::max(_dictionary->size() + _is_nullable, size_t{1}) - 1, vector_compression_type);
+    const auto& other_dictionary = dictionary_segment->dictionary();
+    auto translated_value_ids = std::vector<ValueID>(other_dictionary.size() + 1, null_value_id());
+    for (auto value_id = size_t{0}; value_id < other_dictionary.size(); ++value_id) {
+      translated_value_ids[value_id] = find_value_id(other_dictionary[value_id]);
+    }
+    const auto& other_attribute_vector = *dictionary_segment->attribute_vector();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      _attribute_vector->set(chunk_offset, translated_value_ids[other_attribute_vector.get(chunk_offset)]);
+    }
+  } else if (const auto unsorted_segment = std::dynamic_pointer_cast<UnsortedDictionarySegment<T>>(abstract_segment)) {
+    _is_nullable = unsorted_segment->is_nullable();
+    _attribute_vector = make_fitting_attribute_vector(
+        size, std::max(_dictionary->size() + _is_nullable, size_t{1}) - 1, vector_compression_type);
+    const auto& other_dictionary = unsorted_segment->dictionary();
+    auto translated_value_ids = std::vector<ValueID>(other_dictionary.size());
+    for (auto value_id = size_t{0}; value_id < other_dictionary.size(); ++value_id) {
+      translated_value_ids[value_id] = find_value_id(other_dictionary[value_id]);
+    }
+    const auto& value_ids = unsorted_segment->value_ids();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      const auto value_id = value_ids[chunk_offset];
+      _attribute_vector->set(chunk_offset, value_id == unsorted_segment->null_value_id()
+                                               ? null_value_id()
+                                               : translated_value_ids[value_id]);
+    }
+  } else {
+    Fail("Tried to create DictionarySegment<T> from abstract segment that was neither ValueSegment<T>, "
+         "DictionarySegment<T>, nor UnsortedDictionarySegment<T>.");
   }
 }
 
+template <typename T>
+std::shared_ptr<const typename DictionarySegment<T>::Dictionary> DictionarySegment<T>::build_shared_dictionary(
+    const std::vector<std::shared_ptr<AbstractSegment>>& segments) {
+  auto values = std::set<T>{};
+  for (const auto& segment : segments) {
+    if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment)) {
+      const auto& segment_values = value_segment->values();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_values.size(); ++chunk_offset) {
+        if (!value_segment->is_null(chunk_offset)) {
+          values.emplace(segment_values[chunk_offset]);
+        }
+      }
+    } else if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
+      for (const auto& value : dictionary_segment->dictionary()) {
+        values.emplace(value);
+      }
+    } else if (const auto unsorted_segment = std::dynamic_pointer_cast<UnsortedDictionarySegment<T>>(segment)) {
+      for (const auto& value : unsorted_segment->dictionary()) {
+        values.emplace(value);
+      }
+    } else {
+      Fail("Shared dictionaries can only be built from ValueSegment<T>, DictionarySegment<T>, and "
+           "UnsortedDictionarySegment<T>.");
+    }
+  }
+
+  auto dictionary = std::make_shared<Dictionary>();
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto character_count = size_t{0};
+    for (const auto& value : values) {
+      character_count += value.size();
+    }
+    dictionary->reserve(values.size(), character_count);
+  } else {
+    dictionary->reserve(values.size());
+  }
+  for (const auto& value : values) {
+    dictionary->emplace_back(value);
+  }
+  return dictionary;
+}
+
 template <typename T>
 AllTypeVariant DictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
   if (const auto optional_value = get_typed_value(chunk_offset)) {
@@ -90,10 +258,20 @@ std::optional<T> DictionarySegment<T>::get_typed_value(const ChunkOffset chunk_o
 }
 
 template <typename T>
-const std::vector<T>& DictionarySegment<T>::dictionary() const {
+const typename DictionarySegment<T>::Dictionary& DictionarySegment<T>::dictionary() const {
+  return *_dictionary;
+}
+
+template <typename T>
+std::shared_ptr<const typename DictionarySegment<T>::Dictionary> DictionarySegment<T>::shared_dictionary() const {
   return _dictionary;
 }
 
+template <typename T>
+bool DictionarySegment<T>::has_shared_dictionary() const {
+  return _has_shared_dictionary;
+}
+
 template <typename T>
 std::shared_ptr<const AbstractAttributeVector> DictionarySegment<T>::attribute_vector() const {
   return _attribute_vector;
@@ -105,23 +283,25 @@ ValueID DictionarySegment<T>::null_value_id() const {
     return INVALID_VALUE_ID;
   }
 
-  // The maximum value representable within the attribute vector's width.
-  return ValueID{(1u << attribute_vector()->width() * 8) - 1};
+  // The first value id after the dictionary. It is always representable within the attribute vector's width, no
+  // matter whether its values are stored in whole bytes or bit-packed.
+  return ValueID{static_cast<ValueID::base_type>(_dictionary->size())};
 }
 
 template <typename T>
 const T DictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
   Assert(value_id != null_value_id(), "Tried to get value for null_value_id.");
-  return dictionary().at(value_id);
+  Assert(value_id < _dictionary->size(), "Tried to get value for value id that is not in the dictionary.");
+  return T{(*_dictionary)[value_id]};
 }
 
 template <typename T>
 ValueID DictionarySegment<T>::lower_bound(const T value) const {
-  const auto lower = std::lower_bound(_dictionary.begin(), _dictionary.end(), value);
-  if (lower == _dictionary.end()) {
+  const auto lower = std::lower_bound(_dictionary->begin(), _dictionary->end(), value);
+  if (lower == _dictionary->end()) {
     return INVALID_VALUE_ID;
   }
-  return static_cast<ValueID>(std::distance(_dictionary.begin(), lower));
+  return static_cast<ValueID>(std::distance(_dictionary->begin(), lower));
 }
 
 template <typename T>
@@ -139,11 +319,11 @@ ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
 
 template <typename T>
 ValueID DictionarySegment<T>::upper_bound(const T value) const {
-  const auto upper = std::upper_bound(_dictionary.begin(), _dictionary.end(), value);
-  if (upper == _dictionary.end()) {
+  const auto upper = std::upper_bound(_dictionary->begin(), _dictionary->end(), value);
+  if (upper == _dictionary->end()) {
     return INVALID_VALUE_ID;
   }
-  return static_cast<ValueID>(std::distance(_dictionary.begin(), upper));
+  return static_cast<ValueID>(std::distance(_dictionary->begin(), upper));
 }
 
 template <typename T>
@@ -171,8 +351,18 @@ ChunkOffset DictionarySegment<T>::size() const {
 
 template <typename T>
 size_t DictionarySegment<T>::estimate_memory_usage() const {
-  const auto attribute_vector_memory = attribute_vector()->size() * attribute_vector()->width();
-  const auto dictionary_memory = dictionary().size() * sizeof(T);
+  const auto attribute_vector_memory = attribute_vector()->estimate_memory_usage();
+  if (_has_shared_dictionary) {
+    // A shared dictionary belongs to the column of the table and is not accounted for per segment.
+    return attribute_vector_memory;
+  }
+
+  auto dictionary_memory = size_t{0};
+  if constexpr (std::is_same_v<T, std::string>) {
+    dictionary_memory = dictionary().estimate_memory_usage();
+  } else {
+    dictionary_memory = dictionary().size() * sizeof(T);
+  }
   return attribute_vector_memory + dictionary_memory;
 }
 
@@ -1,20 +1,44 @@
 #pragma once
 
+#include <vector>
+
 #include "abstract_attribute_vector.hpp"
 #include "abstract_segment.hpp"
+#include "string_dictionary.hpp"
 
 namespace opossum {
 
 class AbstractAttributeVector;
 
-// Dictionary is a specific segment type that stores all its values in a vector
+// Dictionary is a specific segment type that stores all its values in a vector. The dictionary is either owned by the
+// segment or shared with the segments of the same column in other chunks (see Table::use_global_dictionary). Segments
+// sharing a dictionary use the same ValueIDs for the same values.
 template <typename T>
 class DictionarySegment : public AbstractSegment {
  public:
+  // Strings are stored in a contiguous StringDictionary, all other types in a std::vector. Both are sorted and can be
+  // accessed by ValueID via operator[].
+  using Dictionary = std::conditional_t<std::is_same_v<T, std::string>, StringDictionary, std::vector<T>>;
+
+  /**
+   * Creates a Dictionary segment from a given value segment or unsorted dictionary segment. The vector compression type
+   * determines how the attribute vector stores its value ids.
+   */
+  explicit DictionarySegment(
+      const std::shared_ptr<AbstractSegment>& abstract_segment,
+      const VectorCompressionType vector_compression_type = VectorCompressionType::FixedWidthInteger);
+
   /**
-   * Creates a Dictionary segment from a given value segment.
+   * Creates a Dictionary segment that uses the given shared dictionary from a value segment or a (unsorted) dictionary
+   * segment of the same column. All values of the segment have to be contained in the dictionary.
    */
-  explicit DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+  DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment,
+                    const std::shared_ptr<const Dictionary>& shared_dictionary,
+                    const VectorCompressionType vector_compression_type = VectorCompressionType::FixedWidthInteger);
+
+  // Creates a dictionary that contains all values of the given value segments and (unsorted) dictionary segments.
+  static std::shared_ptr<const Dictionary> build_shared_dictionary(
+      const std::vector<std::shared_ptr<AbstractSegment>>& segments);
 
   // Returns the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
@@ -26,7 +50,14 @@ class DictionarySegment : public AbstractSegment {
   std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
 
   // Returns an underlying dictionary.
-  const std::vector<T>& dictionary() const;
+  const Dictionary& dictionary() const;
+
+  // Returns the dictionary so that it can be shared with other segments.
+  std::shared_ptr<const Dictionary> shared_dictionary() const;
+
+  // Returns whether the dictionary was passed in by the creator of the segment, i.e., whether it is (potentially)
+  // shared with other segments. Shared dictionaries are not included in estimate_memory_usage().
+  bool has_shared_dictionary() const;
 
   // Returns an underlying data structure.
   std::shared_ptr<const AbstractAttributeVector> attribute_vector() const;
@@ -61,9 +92,10 @@ class DictionarySegment : public AbstractSegment {
   size_t estimate_memory_usage() const final;
 
  protected:
-  std::vector<T> _dictionary;
+  std::shared_ptr<const Dictionary> _dictionary;
   std::shared_ptr<AbstractAttributeVector> _attribute_vector;
   bool _is_nullable;
+  bool _has_shared_dictionary{false};
 };
 
 EXPLICITLY_DECLARE_DATA_TYPES(DictionarySegment);
@@ -0,0 +1,307 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "bit_packed_integer_vector.hpp"
+#include "delta_encoded_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "gorilla_segment.hpp"
+#include "lz_segment.hpp"
+#include "resolve_type.hpp"
+#include "unsorted_dictionary_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Relative costs of scanning one row of a segment, with a DictionarySegment with a FixedWidthInteger attribute vector
+// as the baseline. They roughly reflect the work per row of the respective TableScan implementations.
+constexpr auto DICTIONARY_SCAN_COST = 1.0;
+constexpr auto BIT_PACKED_DICTIONARY_SCAN_COST = 1.2;
+constexpr auto FRAME_OF_REFERENCE_SCAN_COST = 1.0;
+constexpr auto UNSORTED_DELTA_SCAN_COST = 1.5;
+// Sorted delta-encoded segments are searched by binary search, but qualifying rows are still emitted one by one.
+constexpr auto SORTED_DELTA_SCAN_COST = 0.2;
+constexpr auto GORILLA_SCAN_COST = 3.0;
+constexpr auto LZ_SCAN_COST = 4.0;
+// Run-length encoded segments evaluate the predicate once per run and emit the rows of qualifying runs.
+constexpr auto RUN_LENGTH_ROW_SCAN_COST = 0.2;
+
+// Number of contiguous windows the sample for Gorilla and LZ encoding is taken from.
+constexpr auto SAMPLE_WINDOW_COUNT = size_t{4};
+
+struct Candidate {
+  SegmentEncodingSpec encoding_spec;
+  size_t expected_memory_usage;
+  double scan_cost;
+};
+
+// Properties of a ValueSegment that determine the sizes of its encodings.
+struct SegmentProperties {
+  size_t row_count{0};
+  size_t distinct_count{0};
+  size_t run_count{0};
+  double average_string_length{0.0};
+  // The following are only computed for integer columns. They use the same definitions as FrameOfReferenceSegment
+  // and DeltaEncodedSegment, i.e., the largest offset to a block minimum and the largest (zigzag-encoded) delta.
+  bool is_sorted{false};
+  uint64_t max_block_range{0};
+  uint64_t max_delta{0};
+};
+
+size_t bitmap_bytes(const size_t bit_count) {
+  return (bit_count + Bitmap::WORD_BITS - 1) / Bitmap::WORD_BITS * sizeof(uint64_t);
+}
+
+size_t bit_packed_bytes(const size_t size, const uint64_t max_value) {
+  const auto bit_width = std::max(static_cast<size_t>(std::bit_width(max_value)), size_t{1});
+  const auto block_count = (size + BitPackedIntegerVector::BLOCK_SIZE - 1) / BitPackedIntegerVector::BLOCK_SIZE;
+  return block_count * bit_width * sizeof(uint64_t);
+}
+
+// Estimates the number of distinct non-NULL values from a sample of every stride-th row with the GEE estimator:
+// values that occur once in the sample are scaled by sqrt(row_count / sample_row_count), all others are counted once.
+template <typename T>
+size_t estimate_distinct_count(const ValueSegment<T>& segment, const size_t sample_size) {
+  using KeyType = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+  const auto& values = segment.values();
+  const auto stride = std::max(values.size() / std::max(sample_size, size_t{1}), size_t{1});
+  auto occurrences = std::unordered_map<KeyType, size_t>{};
+  auto sample_row_count = size_t{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); chunk_offset += stride) {
+    if (!segment.is_null(chunk_offset)) {
+      ++occurrences[KeyType{values[chunk_offset]}];
+      ++sample_row_count;
+    }
+  }
+
+  if (stride == 1) {
+    return occurrences.size();
+  }
+
+  const auto singletons = std::ranges::count_if(occurrences, [](const auto& entry) { return entry.second == 1; });
+  const auto scale = std::sqrt(static_cast<double>(values.size()) / static_cast<double>(sample_row_count));
+  return static_cast<size_t>(std::lround(scale * static_cast<double>(singletons))) + occurrences.size() - singletons;
+}
+
+template <typename T>
+SegmentProperties analyze_segment(const ValueSegment<T>& segment, const size_t sample_size) {
+  const auto& values = segment.values();
+  auto properties = SegmentProperties{};
+  properties.row_count = values.size();
+  properties.distinct_count = estimate_distinct_count(segment, sample_size);
+
+  // Runs are counted as RunLengthSegment forms them, i.e., consecutive NULL values form one run.
+  auto non_null_count = size_t{0};
+  auto character_count = size_t{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    const auto is_null = segment.is_null(chunk_offset);
+    if (chunk_offset == 0 || is_null != segment.is_null(chunk_offset - 1) ||
+        (!is_null && !(values[chunk_offset] == values[chunk_offset - 1]))) {
+      ++properties.run_count;
+    }
+    if constexpr (std::is_same_v<T, std::string>) {
+      if (!is_null) {
+        ++non_null_count;
+        character_count += values[chunk_offset].size();
+      }
+    }
+  }
+  if (non_null_count > 0) {
+    properties.average_string_length = static_cast<double>(character_count) / static_cast<double>(non_null_count);
+  }
+
+  if constexpr (std::is_integral_v<T>) {
+    using UnsignedT = std::make_unsigned_t<T>;
+
+    // Block ranges of FrameOfReferenceSegment, which ignores NULL values.
+    constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+    for (auto block_begin = size_t{0}; block_begin < values.size(); block_begin += BLOCK_SIZE) {
+      const auto block_end = std::min(block_begin + BLOCK_SIZE, values.size());
+      auto block_min = std::numeric_limits<T>::max();
+      auto block_max = std::numeric_limits<T>::min();
+      for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+        if (!segment.is_null(chunk_offset)) {
+          block_min = std::min(block_min, values[chunk_offset]);
+          block_max = std::max(block_max, values[chunk_offset]);
+        }
+      }
+      if (block_min <= block_max) {
+        properties.max_block_range = std::max(
+            properties.max_block_range, static_cast<uint64_t>(static_cast<UnsignedT>(block_max) - block_min));
+      }
+    }
+
+    // Deltas of DeltaEncodedSegment, where NULL values repeat the previous value and leading NULL values do not
+    // contribute any delta.
+    auto previous_value = std::optional<T>{};
+    auto max_positive_delta = uint64_t{0};
+    auto max_zigzag_delta = uint64_t{0};
+    properties.is_sorted = true;
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      if (segment.is_null(chunk_offset)) {
+        continue;
+      }
+      const auto value = values[chunk_offset];
+      if (previous_value) {
+        const auto delta = static_cast<UnsignedT>(static_cast<UnsignedT>(value) - *previous_value);
+        const auto sign_mask =
+            static_cast<UnsignedT>(UnsignedT{0} - (delta >> (std::numeric_limits<UnsignedT>::digits - 1)));
+        const auto zigzag_delta = static_cast<UnsignedT>(static_cast<UnsignedT>(delta << 1) ^ sign_mask);
+        max_zigzag_delta = std::max(max_zigzag_delta, static_cast<uint64_t>(zigzag_delta));
+        if (value < *previous_value) {
+          properties.is_sorted = false;
+        } else {
+          max_positive_delta = std::max(max_positive_delta, static_cast<uint64_t>(delta));
+        }
+      }
+      previous_value = value;
+    }
+    properties.max_delta = properties.is_sorted ? max_positive_delta : max_zigzag_delta;
+  }
+
+  return properties;
+}
+
+// Encodes a sample of contiguous windows of the segment with the given encoding and extrapolates the memory usage of
+// the encoded sample (without NULL values) to the full segment.
+template <typename EncodedSegment, typename T>
+size_t extrapolate_memory_usage(const ValueSegment<T>& segment, const size_t sample_size) {
+  const auto size = static_cast<size_t>(segment.size());
+  const auto window_size = std::max(sample_size / SAMPLE_WINDOW_COUNT, size_t{1});
+  auto sample = std::make_shared<ValueSegment<T>>(false);
+  for (auto window_index = size_t{0}; window_index < SAMPLE_WINDOW_COUNT; ++window_index) {
+    // Small segments are encoded completely, larger ones are sampled in evenly spaced windows.
+    const auto window_begin =
+        size <= sample_size ? window_index * window_size : size / SAMPLE_WINDOW_COUNT * window_index;
+    const auto window_end = std::min(window_begin + window_size, size);
+    for (auto chunk_offset = window_begin; chunk_offset < window_end; ++chunk_offset) {
+      if (!segment.is_null(chunk_offset)) {
+        sample->append(T{segment.values()[chunk_offset]});
+      }
+    }
+  }
+
+  if (sample->size() == 0) {
+    return 0;
+  }
+  const auto sample_memory_usage = std::make_shared<EncodedSegment>(sample)->estimate_memory_usage();
+  return sample_memory_usage * size / sample->size();
+}
+
+template <typename T>
+std::vector<Candidate> collect_candidates(const ValueSegment<T>& segment, const size_t sample_size) {
+  const auto properties = analyze_segment(segment, sample_size);
+  const auto row_count = properties.row_count;
+  const auto null_bitmap_bytes = segment.is_nullable() ? bitmap_bytes(row_count) : size_t{0};
+  auto candidates = std::vector<Candidate>{};
+
+  // DictionarySegment: the dictionary plus an attribute vector that also holds the NULL value id.
+  const auto distinct_count = properties.distinct_count;
+  auto dictionary_bytes = distinct_count * sizeof(T);
+  if constexpr (std::is_same_v<T, std::string>) {
+    dictionary_bytes = static_cast<size_t>(std::lround(properties.average_string_length * distinct_count)) +
+                       (distinct_count + 1) * sizeof(uint32_t);
+  }
+  const auto max_value_id = static_cast<uint64_t>(std::max(distinct_count + segment.is_nullable(), size_t{1}) - 1);
+  const auto value_id_bits = std::bit_width(max_value_id);
+  const auto value_id_bytes = value_id_bits <= 8 ? size_t{1} : value_id_bits <= 16 ? size_t{2} : size_t{4};
+  candidates.push_back({SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger},
+                        dictionary_bytes + row_count * value_id_bytes, DICTIONARY_SCAN_COST});
+  candidates.push_back({SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking},
+                        dictionary_bytes + bit_packed_bytes(row_count, max_value_id),
+                        BIT_PACKED_DICTIONARY_SCAN_COST});
+
+  const auto run_count = properties.run_count;
+  candidates.push_back({SegmentEncodingSpec{EncodingType::RunLength},
+                        run_count * (sizeof(T) + sizeof(ChunkOffset)) + bitmap_bytes(run_count),
+                        RUN_LENGTH_ROW_SCAN_COST + static_cast<double>(run_count) / std::max(row_count, size_t{1})});
+
+  if constexpr (std::is_integral_v<T>) {
+    constexpr auto MAX_OFFSET = uint64_t{std::numeric_limits<ValueID::base_type>::max()};
+    if (properties.max_block_range <= MAX_OFFSET) {
+      const auto block_count = (row_count + FrameOfReferenceSegment<T>::BLOCK_SIZE - 1) /
+                               FrameOfReferenceSegment<T>::BLOCK_SIZE;
+      candidates.push_back({SegmentEncodingSpec{EncodingType::FrameOfReference},
+                            block_count * sizeof(T) + bit_packed_bytes(row_count, properties.max_block_range) +
+                                null_bitmap_bytes,
+                            FRAME_OF_REFERENCE_SCAN_COST});
+    }
+    if (properties.max_delta <= MAX_OFFSET) {
+      const auto block_count =
+          (row_count + DeltaEncodedSegment<T>::BLOCK_SIZE - 1) / DeltaEncodedSegment<T>::BLOCK_SIZE;
+      candidates.push_back({SegmentEncodingSpec{EncodingType::Delta},
+                            block_count * sizeof(T) + bit_packed_bytes(row_count, properties.max_delta) +
+                                null_bitmap_bytes,
+                            properties.is_sorted ? SORTED_DELTA_SCAN_COST : UNSORTED_DELTA_SCAN_COST});
+    }
+  }
+
+  if constexpr (std::is_floating_point_v<T>) {
+    candidates.push_back({SegmentEncodingSpec{EncodingType::Gorilla},
+                          extrapolate_memory_usage<GorillaSegment<T>>(segment, sample_size) + null_bitmap_bytes,
+                          GORILLA_SCAN_COST});
+  }
+
+  candidates.push_back({SegmentEncodingSpec{EncodingType::LZ},
+                        extrapolate_memory_usage<LZSegment<T>>(segment, sample_size) + null_bitmap_bytes,
+                        LZ_SCAN_COST});
+  return candidates;
+}
+
+}  // namespace
+
+EncodingAdvisor::EncodingAdvisor(const EncodingGoal goal, const size_t sample_size)
+    : _goal{goal}, _sample_size{sample_size} {
+  Assert(sample_size >= SAMPLE_WINDOW_COUNT, "EncodingAdvisor needs a sample size of at least " +
+                                                 std::to_string(SAMPLE_WINDOW_COUNT) + " rows.");
+}
+
+EncodingRecommendation EncodingAdvisor::recommend(const std::string& data_type,
+                                                  const std::shared_ptr<AbstractSegment>& value_segment) const {
+  auto candidates = std::vector<Candidate>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using DataType = typename decltype(type)::type;
+    auto typed_segment = std::dynamic_pointer_cast<ValueSegment<DataType>>(value_segment);
+    if (const auto unsorted_segment = std::dynamic_pointer_cast<UnsortedDictionarySegment<DataType>>(value_segment)) {
+      typed_segment = unsorted_segment->materialize();
+    }
+    Assert(typed_segment, "EncodingAdvisor can only recommend encodings for ValueSegments of type " + data_type + ".");
+    candidates = collect_candidates(*typed_segment, _sample_size);
+  });
+
+  // Memory usage and scan cost are compared lexicographically for the single-objective goals. The balanced goal
+  // minimizes their product, i.e., it accepts twice the memory usage for half the scan cost.
+  const auto is_better = [&](const Candidate& lhs, const Candidate& rhs) {
+    switch (_goal) {
+      case EncodingGoal::MinimumMemory:
+        return std::tie(lhs.expected_memory_usage, lhs.scan_cost) < std::tie(rhs.expected_memory_usage, rhs.scan_cost);
+      case EncodingGoal::FastestScan:
+        return std::tie(lhs.scan_cost, lhs.expected_memory_usage) < std::tie(rhs.scan_cost, rhs.expected_memory_usage);
+      case EncodingGoal::Balanced:
+        return static_cast<double>(lhs.expected_memory_usage) * lhs.scan_cost <
+               static_cast<double>(rhs.expected_memory_usage) * rhs.scan_cost;
+    }
+    Fail("Unknown encoding goal.");
+  };
+
+  const auto& best_candidate = *std::ranges::min_element(candidates, is_better);
+  return EncodingRecommendation{best_candidate.encoding_spec, best_candidate.expected_memory_usage};
+}
+
+EncodingGoal EncodingAdvisor::goal() const {
+  return _goal;
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// The encoding chosen for a segment and the memory usage the encoded segment is expected to have.
+struct EncodingRecommendation {
+  SegmentEncodingSpec encoding_spec;
+  size_t expected_memory_usage{0};
+};
+
+// Describes how a column of a chunk was encoded by Table::compress_chunk with an EncodingAdvisor.
+struct SegmentEncodingReport {
+  ColumnID column_id;
+  SegmentEncodingSpec encoding_spec;
+  size_t expected_memory_usage{0};
+  size_t actual_memory_usage{0};
+};
+
+// EncodingAdvisor chooses the encoding of a ValueSegment based on the properties of its data. Properties that are
+// cheap to compute, i.e., the number of runs, sortedness, and the value ranges relevant for FrameOfReference and
+// Delta encoding, are determined exactly in one pass. The number of distinct values is estimated from a sample, and
+// the sizes of Gorilla and LZ segments are extrapolated by encoding a sample. Each applicable encoding gets an expected
+// memory usage and a relative scan cost per row, and the encoding that is best for the goal is chosen.
+class EncodingAdvisor {
+ public:
+  static constexpr auto DEFAULT_SAMPLE_SIZE = size_t{2048};
+
+  explicit EncodingAdvisor(const EncodingGoal goal = EncodingGoal::Balanced,
+                           const size_t sample_size = DEFAULT_SAMPLE_SIZE);
+
+  // Returns the recommended encoding for a ValueSegment of the given data type. UnsortedDictionarySegments are
+  // materialized into a ValueSegment first.
+  EncodingRecommendation recommend(const std::string& data_type,
+                                   const std::shared_ptr<AbstractSegment>& value_segment) const;
+
+  EncodingGoal goal() const;
+
+ protected:
+  EncodingGoal _goal;
+  size_t _sample_size;
+};
+
+}  // namespace opossum
@@ -1,5 +1,9 @@
 #include "fixed_width_integer_vector.hpp"
 
+#include <algorithm>
+
+#include "utils/assert.hpp"
+
 namespace opossum {
 
 template <std::unsigned_integral T>
@@ -7,7 +11,15 @@ FixedWidthIntegerVector<T>::FixedWidthIntegerVector(size_t size) : _value_ids(si
 
 template <std::unsigned_integral T>
 ValueID FixedWidthIntegerVector<T>::get(const size_t index) const {
-  return ValueID{_value_ids.at(index)};
+  DebugAssert(index < _value_ids.size(), "Tried to access FixedWidthIntegerVector out of bounds.");
+  return ValueID{_value_ids[index]};
+}
+
+template <std::unsigned_integral T>
+void FixedWidthIntegerVector<T>::decode(const size_t begin, std::span<ValueID> output) const {
+  Assert(begin + output.size() <= _value_ids.size(), "Tried to decode FixedWidthIntegerVector out of bounds.");
+  std::transform(_value_ids.begin() + begin, _value_ids.begin() + begin + output.size(), output.begin(),
+                 [](const T value_id) { return ValueID{value_id}; });
 }
 
 template <std::unsigned_integral T>
@@ -25,6 +37,16 @@ AttributeVectorWidth FixedWidthIntegerVector<T>::width() const {
   return sizeof(T);
 }
 
+template <std::unsigned_integral T>
+size_t FixedWidthIntegerVector<T>::estimate_memory_usage() const {
+  return _value_ids.size() * sizeof(T);
+}
+
+template <std::unsigned_integral T>
+const std::vector<T>& FixedWidthIntegerVector<T>::values() const {
+  return _value_ids;
+}
+
 template class FixedWidthIntegerVector<uint8_t>;
 template class FixedWidthIntegerVector<uint16_t>;
 template class FixedWidthIntegerVector<uint32_t>;
@@ -15,6 +15,9 @@ class FixedWidthIntegerVector final : public AbstractAttributeVector {
   // Returns the value id at a given position.
   ValueID get(const size_t index) const override;
 
+  // Decodes output.size() consecutive value ids starting at position begin into output.
+  void decode(const size_t begin, std::span<ValueID> output) const override;
+
   // Sets the value id at a given position.
   void set(const size_t index, const ValueID value_id) override;
 
@@ -24,6 +27,12 @@ class FixedWidthIntegerVector final : public AbstractAttributeVector {
   // Returns the width of biggest value id in bytes.
   AttributeVectorWidth width() const override;
 
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const override;
+
+  // Returns the underlying value ids. Operators can iterate over them without any conversion or virtual call.
+  const std::vector<T>& values() const;
+
  private:
   std::vector<T> _value_ids;
 };
@@ -0,0 +1,143 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <std::integral T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
+  Assert(value_segment,
+         "Tried to create FrameOfReferenceSegment<T> from abstract segment that was not ValueSegment<T>.");
+  _is_nullable = value_segment->is_nullable();
+
+  const auto& values = value_segment->values();
+  const auto size = static_cast<ChunkOffset>(values.size());
+  const auto block_count = (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_minima.reserve(block_count);
+
+  // First pass: find the minimum of each block and the largest offset within any block.
+  auto max_offset = UnsignedT{0};
+  for (auto block_begin = ChunkOffset{0}; block_begin < size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, size);
+    auto block_min = std::numeric_limits<T>::max();
+    auto block_max = std::numeric_limits<T>::min();
+    auto has_values = false;
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      if (value_segment->is_null(chunk_offset)) {
+        continue;
+      }
+      block_min = std::min(block_min, values[chunk_offset]);
+      block_max = std::max(block_max, values[chunk_offset]);
+      has_values = true;
+    }
+
+    if (!has_values) {
+      _block_minima.emplace_back(T{0});
+      continue;
+    }
+
+    _block_minima.emplace_back(block_min);
+    // The subtraction is done unsigned since the difference of two signed values might overflow.
+    max_offset = std::max(max_offset, static_cast<UnsignedT>(static_cast<UnsignedT>(block_max) - block_min));
+  }
+
+  Assert(max_offset <= std::numeric_limits<ValueID::base_type>::max(),
+         "Cannot create FrameOfReferenceSegment for blocks that span more than 2^32 values.");
+  const auto bit_width = std::max(static_cast<uint8_t>(std::bit_width(max_offset)), uint8_t{1});
+  _offsets = std::make_shared<BitPackedIntegerVector>(size, bit_width);
+
+  // Second pass: store the offsets.
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    if (value_segment->is_null(chunk_offset)) {
+      continue;
+    }
+    const auto block_min = _block_minima[chunk_offset / BLOCK_SIZE];
+    const auto offset = static_cast<UnsignedT>(static_cast<UnsignedT>(values[chunk_offset]) - block_min);
+    _offsets->set(chunk_offset, ValueID{static_cast<ValueID::base_type>(offset)});
+  }
+
+  if (_is_nullable) {
+    _null_values = value_segment->null_values();
+  }
+}
+
+template <std::integral T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (const auto optional_value = get_typed_value(chunk_offset)) {
+    return *optional_value;
+  }
+  return NULL_VALUE;
+}
+
+template <std::integral T>
+bool FrameOfReferenceSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return is_nullable() && _null_values[chunk_offset];
+}
+
+template <std::integral T>
+T FrameOfReferenceSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  Assert(optional_value.has_value(),
+         "Tried to `.get` value at offset " + std::to_string(chunk_offset) + " that was NULL.");
+  return *optional_value;
+}
+
+template <std::integral T>
+std::optional<T> FrameOfReferenceSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  Assert(chunk_offset < size(), "Tried to access FrameOfReferenceSegment out of bounds.");
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  const auto block_min = static_cast<UnsignedT>(_block_minima[chunk_offset / BLOCK_SIZE]);
+  return static_cast<T>(static_cast<UnsignedT>(block_min + _offsets->get(chunk_offset)));
+}
+
+template <std::integral T>
+const std::vector<T>& FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <std::integral T>
+std::shared_ptr<const BitPackedIntegerVector> FrameOfReferenceSegment<T>::offsets() const {
+  return _offsets;
+}
+
+template <std::integral T>
+bool FrameOfReferenceSegment<T>::is_nullable() const {
+  return _is_nullable;
+}
+
+template <std::integral T>
+const Bitmap& FrameOfReferenceSegment<T>::null_values() const {
+  Assert(is_nullable(), "Tried to get null_values of non-nullable FrameOfReferenceSegment.");
+  return _null_values;
+}
+
+template <std::integral T>
+ChunkOffset FrameOfReferenceSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_offsets->size());
+}
+
+template <std::integral T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return _block_minima.size() * sizeof(T) + _offsets->estimate_memory_usage() +
+         _null_values.estimate_memory_usage();
+}
+
+template class FrameOfReferenceSegment<int8_t>;
+template class FrameOfReferenceSegment<int16_t>;
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <concepts>
+#include <vector>
+
+#include "abstract_segment.hpp"
+#include "bitmap.hpp"
+#include "bit_packed_integer_vector.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is a specific segment type for integer columns. It splits the segment into blocks of
+// BLOCK_SIZE values and stores the minimum of each block plus, for each value, its offset to that minimum. All offsets
+// are bit-packed with the width of the largest offset, so segments with narrow value ranges per block (e.g., increasing
+// ids or timestamps) compress well even if almost all values are distinct.
+template <std::integral T>
+class FrameOfReferenceSegment : public AbstractSegment {
+ public:
+  // A multiple of BitPackedIntegerVector::BLOCK_SIZE so that blocks can be unpacked without unaligned accesses.
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+
+  /**
+   * Creates a FrameOfReference segment from a given value segment. Fails if the values of a block span more than
+   * 2^32 distinct values.
+   */
+  explicit FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns the minimum value of each block. Blocks that only contain NULL values have a minimum of 0.
+  const std::vector<T>& block_minima() const;
+
+  // Returns the offsets of all values to the minimum of their block. NULL values have an offset of 0.
+  std::shared_ptr<const BitPackedIntegerVector> offsets() const;
+
+  // Returns whether segment supports NULL values.
+  bool is_nullable() const;
+
+  // Returns NULL value bitmap that indicates whether a value is NULL with true at position i. Throws an exception if
+  // is_nullable() returns false.
+  const Bitmap& null_values() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::vector<T> _block_minima;
+  std::shared_ptr<BitPackedIntegerVector> _offsets;
+  Bitmap _null_values;
+  bool _is_nullable;
+};
+
+extern template class FrameOfReferenceSegment<int8_t>;
+extern template class FrameOfReferenceSegment<int16_t>;
+extern template class FrameOfReferenceSegment<int32_t>;
+extern template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
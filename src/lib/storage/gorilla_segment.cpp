@@ -0,0 +1,230 @@
+#include "gorilla_segment.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <type_traits>
+
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto WORD_BITS = uint64_t{64};
+
+// Appends values of up to 64 bits to a little-endian bit stream.
+class BitWriter {
+ public:
+  explicit BitWriter(std::vector<uint64_t>& words) : _words{words} {}
+
+  void write(const uint64_t value, const uint64_t bit_count) {
+    const auto shift = _position % WORD_BITS;
+    if (shift == 0) {
+      _words.emplace_back(0);
+    }
+    const auto masked_value = bit_count == WORD_BITS ? value : value & ((uint64_t{1} << bit_count) - 1);
+    _words.back() |= masked_value << shift;
+    if (shift + bit_count > WORD_BITS) {
+      _words.emplace_back(masked_value >> (WORD_BITS - shift));
+    }
+    _position += bit_count;
+  }
+
+  uint64_t position() const {
+    return _position;
+  }
+
+ private:
+  std::vector<uint64_t>& _words;
+  uint64_t _position{0};
+};
+
+// Reads values of up to 64 bits from a little-endian bit stream.
+class BitReader {
+ public:
+  BitReader(const std::vector<uint64_t>& words, const uint64_t position) : _words{words}, _position{position} {}
+
+  uint64_t read(const uint64_t bit_count) {
+    const auto word = _position / WORD_BITS;
+    const auto shift = _position % WORD_BITS;
+    auto value = _words[word] >> shift;
+    if (shift + bit_count > WORD_BITS) {
+      value |= _words[word + 1] << (WORD_BITS - shift);
+    }
+    _position += bit_count;
+    return bit_count == WORD_BITS ? value : value & ((uint64_t{1} << bit_count) - 1);
+  }
+
+ private:
+  const std::vector<uint64_t>& _words;
+  uint64_t _position;
+};
+
+// The number of bits needed to store a count of leading zeros or the length of the meaningful bits minus one.
+template <typename T>
+constexpr auto COUNT_BITS = uint64_t{sizeof(T) == 4 ? 5 : 6};
+
+template <typename T>
+using BitsOf = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+}  // namespace
+
+template <std::floating_point T>
+GorillaSegment<T>::GorillaSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  using Bits = BitsOf<T>;
+  constexpr auto VALUE_BITS = uint64_t{sizeof(Bits) * 8};
+
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
+  Assert(value_segment, "Tried to create GorillaSegment<T> from abstract segment that was not ValueSegment<T>.");
+  _is_nullable = value_segment->is_nullable();
+  _size = value_segment->size();
+
+  const auto& values = value_segment->values();
+  auto writer = BitWriter{_bits};
+
+  for (auto block_begin = ChunkOffset{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+    _block_bit_offsets.emplace_back(writer.position());
+
+    // The first value of each block is stored uncompressed.
+    auto previous = value_segment->is_null(block_begin) ? Bits{0} : std::bit_cast<Bits>(values[block_begin]);
+    writer.write(previous, VALUE_BITS);
+    auto previous_leading_zeros = uint64_t{VALUE_BITS};
+    auto previous_trailing_zeros = uint64_t{0};
+
+    for (auto chunk_offset = block_begin + 1; chunk_offset < block_end; ++chunk_offset) {
+      // NULL values repeat their predecessor, which costs a single bit.
+      const auto current =
+          value_segment->is_null(chunk_offset) ? previous : std::bit_cast<Bits>(values[chunk_offset]);
+      const auto xor_value = static_cast<Bits>(current ^ previous);
+      previous = current;
+
+      if (xor_value == 0) {
+        writer.write(0, 1);
+        continue;
+      }
+      writer.write(1, 1);
+
+      const auto leading_zeros = static_cast<uint64_t>(std::countl_zero(xor_value));
+      const auto trailing_zeros = static_cast<uint64_t>(std::countr_zero(xor_value));
+      if (leading_zeros >= previous_leading_zeros && trailing_zeros >= previous_trailing_zeros) {
+        // The meaningful bits fit into the previous window.
+        writer.write(0, 1);
+        const auto meaningful_bits = VALUE_BITS - previous_leading_zeros - previous_trailing_zeros;
+        writer.write(xor_value >> previous_trailing_zeros, meaningful_bits);
+        continue;
+      }
+
+      // Start a new window. The count of leading zeros is capped so that it fits into COUNT_BITS bits.
+      const auto stored_leading_zeros = std::min(leading_zeros, (uint64_t{1} << COUNT_BITS<T>) - 1);
+      const auto meaningful_bits = VALUE_BITS - stored_leading_zeros - trailing_zeros;
+      writer.write(1, 1);
+      writer.write(stored_leading_zeros, COUNT_BITS<T>);
+      writer.write(meaningful_bits - 1, COUNT_BITS<T>);
+      writer.write(xor_value >> trailing_zeros, meaningful_bits);
+      previous_leading_zeros = stored_leading_zeros;
+      previous_trailing_zeros = trailing_zeros;
+    }
+  }
+
+  if (_is_nullable) {
+    _null_values = value_segment->null_values();
+  }
+}
+
+template <std::floating_point T>
+AllTypeVariant GorillaSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (const auto optional_value = get_typed_value(chunk_offset)) {
+    return *optional_value;
+  }
+  return NULL_VALUE;
+}
+
+template <std::floating_point T>
+bool GorillaSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return is_nullable() && _null_values[chunk_offset];
+}
+
+template <std::floating_point T>
+T GorillaSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  Assert(optional_value.has_value(),
+         "Tried to `.get` value at offset " + std::to_string(chunk_offset) + " that was NULL.");
+  return *optional_value;
+}
+
+template <std::floating_point T>
+std::optional<T> GorillaSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < _size, "Tried to access GorillaSegment out of bounds.");
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  auto block = std::array<T, BLOCK_SIZE>{};
+  decode_block(chunk_offset / BLOCK_SIZE, block);
+  return block[chunk_offset % BLOCK_SIZE];
+}
+
+template <std::floating_point T>
+void GorillaSegment<T>::decode_block(const size_t block_index, std::span<T> output) const {
+  using Bits = BitsOf<T>;
+  constexpr auto VALUE_BITS = uint64_t{sizeof(Bits) * 8};
+
+  Assert(block_index < block_count(), "Tried to decode block of GorillaSegment out of bounds.");
+  const auto block_begin = static_cast<ChunkOffset>(block_index * BLOCK_SIZE);
+  const auto block_size = std::min(BLOCK_SIZE, _size - block_begin);
+  Assert(output.size() >= block_size, "Output is too small for the block of GorillaSegment.");
+
+  auto reader = BitReader{_bits, _block_bit_offsets[block_index]};
+  auto previous = static_cast<Bits>(reader.read(VALUE_BITS));
+  output[0] = std::bit_cast<T>(previous);
+  auto leading_zeros = uint64_t{VALUE_BITS};
+  auto trailing_zeros = uint64_t{0};
+
+  for (auto index = ChunkOffset{1}; index < block_size; ++index) {
+    if (reader.read(1) == 1) {
+      if (reader.read(1) == 1) {
+        leading_zeros = reader.read(COUNT_BITS<T>);
+        const auto meaningful_bits = reader.read(COUNT_BITS<T>) + 1;
+        trailing_zeros = VALUE_BITS - leading_zeros - meaningful_bits;
+      }
+      const auto meaningful_value = reader.read(VALUE_BITS - leading_zeros - trailing_zeros);
+      previous ^= static_cast<Bits>(meaningful_value << trailing_zeros);
+    }
+    output[index] = std::bit_cast<T>(previous);
+  }
+}
+
+template <std::floating_point T>
+size_t GorillaSegment<T>::block_count() const {
+  return _block_bit_offsets.size();
+}
+
+template <std::floating_point T>
+bool GorillaSegment<T>::is_nullable() const {
+  return _is_nullable;
+}
+
+template <std::floating_point T>
+const Bitmap& GorillaSegment<T>::null_values() const {
+  Assert(is_nullable(), "Tried to get null_values of non-nullable GorillaSegment.");
+  return _null_values;
+}
+
+template <std::floating_point T>
+ChunkOffset GorillaSegment<T>::size() const {
+  return _size;
+}
+
+template <std::floating_point T>
+size_t GorillaSegment<T>::estimate_memory_usage() const {
+  return _bits.size() * sizeof(uint64_t) + _block_bit_offsets.size() * sizeof(uint64_t) +
+         _null_values.estimate_memory_usage();
+}
+
+template class GorillaSegment<float>;
+template class GorillaSegment<double>;
+
+}  // namespace opossum
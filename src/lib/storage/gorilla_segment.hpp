@@ -0,0 +1,72 @@
+#pragma once
+
+#include <concepts>
+#include <span>
+#include <vector>
+
+#include "abstract_segment.hpp"
+#include "bitmap.hpp"
+
+namespace opossum {
+
+// GorillaSegment is a specific segment type for float and double columns that losslessly compresses values with the
+// XOR scheme of Facebook's Gorilla time series database. Each value is XORed with its predecessor. If both are equal,
+// only a single bit is stored. Otherwise, only the meaningful bits between the leading and trailing zeros of the XOR
+// are stored, reusing the previous window of meaningful bits if it fits. Values are split into blocks of BLOCK_SIZE
+// values that can be decoded independently of each other.
+template <std::floating_point T>
+class GorillaSegment : public AbstractSegment {
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{1024};
+
+  /**
+   * Creates a Gorilla segment from a given value segment.
+   */
+  explicit GorillaSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. This decodes the block up to the position. If you want to write efficient
+  // operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Decodes all values of the given block into output, which has to hold at least as many values as the block. NULL
+  // values are decoded as the value of their predecessor (or 0 if they start the block).
+  void decode_block(const size_t block_index, std::span<T> output) const;
+
+  // Returns the number of blocks.
+  size_t block_count() const;
+
+  // Returns whether segment supports NULL values.
+  bool is_nullable() const;
+
+  // Returns NULL value bitmap that indicates whether a value is NULL with true at position i. Throws an exception if
+  // is_nullable() returns false.
+  const Bitmap& null_values() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::vector<uint64_t> _bits;
+  // The position of the first bit of each block in _bits.
+  std::vector<uint64_t> _block_bit_offsets;
+  Bitmap _null_values;
+  ChunkOffset _size;
+  bool _is_nullable;
+};
+
+extern template class GorillaSegment<float>;
+extern template class GorillaSegment<double>;
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#include "inline_string.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the length and the prefix, i.e., the first eight bytes of an InlineString, as one integer.
+uint64_t length_and_prefix(const InlineString& string) {
+  auto head = uint64_t{0};
+  std::memcpy(&head, &string, sizeof(head));
+  return head;
+}
+
+// Compares two prefixes of PREFIX_LENGTH characters. Missing characters of short strings are zero, which sorts
+// before all other characters. Equal prefixes do not imply equal strings, e.g., for embedded null characters.
+int compare_prefixes(const char* lhs, const char* rhs) {
+  return std::memcmp(lhs, rhs, InlineString::PREFIX_LENGTH);
+}
+
+}  // namespace
+
+InlineString::InlineString(const std::string_view value) : _length{static_cast<uint32_t>(value.size())} {
+  Assert(value.size() <= std::numeric_limits<uint32_t>::max(), "InlineString cannot hold more than 4 GB.");
+  if (value.empty()) {
+    return;
+  }
+
+  std::memcpy(_prefix.data(), value.data(), std::min(value.size(), PREFIX_LENGTH));
+  if (!is_inlined()) {
+    _characters = value.data();
+  } else if (value.size() > PREFIX_LENGTH) {
+    std::memcpy(_suffix.data(), value.data() + PREFIX_LENGTH, value.size() - PREFIX_LENGTH);
+  }
+}
+
+size_t InlineString::size() const {
+  return _length;
+}
+
+bool InlineString::is_inlined() const {
+  return _length <= INLINE_LENGTH;
+}
+
+const char* InlineString::data() const {
+  // _prefix and _suffix are adjacent, so the characters of inlined strings are contiguous.
+  return is_inlined() ? _prefix.data() : _characters;
+}
+
+InlineString::operator std::string_view() const {
+  return std::string_view{data(), _length};
+}
+
+bool operator==(const InlineString& lhs, const InlineString& rhs) {
+  if (length_and_prefix(lhs) != length_and_prefix(rhs)) {
+    return false;
+  }
+  if (lhs.is_inlined()) {
+    return lhs._suffix == rhs._suffix;
+  }
+  return std::memcmp(lhs._characters + InlineString::PREFIX_LENGTH, rhs._characters + InlineString::PREFIX_LENGTH,
+                     lhs._length - InlineString::PREFIX_LENGTH) == 0;
+}
+
+std::strong_ordering operator<=>(const InlineString& lhs, const InlineString& rhs) {
+  if (const auto result = compare_prefixes(lhs._prefix.data(), rhs._prefix.data()); result != 0) {
+    return result <=> 0;
+  }
+  return std::string_view{lhs} <=> std::string_view{rhs};
+}
+
+bool operator==(const InlineString& lhs, const std::string_view rhs) {
+  if (lhs._length != rhs.size()) {
+    return false;
+  }
+  if (!std::equal(rhs.begin(), rhs.begin() + std::min(rhs.size(), InlineString::PREFIX_LENGTH), lhs._prefix.begin())) {
+    return false;
+  }
+  return std::string_view{lhs} == rhs;
+}
+
+std::strong_ordering operator<=>(const InlineString& lhs, const std::string_view rhs) {
+  auto rhs_prefix = std::array<char, InlineString::PREFIX_LENGTH>{};
+  std::copy_n(rhs.begin(), std::min(rhs.size(), InlineString::PREFIX_LENGTH), rhs_prefix.begin());
+  if (const auto result = compare_prefixes(lhs._prefix.data(), rhs_prefix.data()); result != 0) {
+    return result <=> 0;
+  }
+  return std::string_view{lhs} <=> rhs;
+}
+
+InlineString StringArena::store(const std::string_view value) {
+  if (value.size() <= InlineString::INLINE_LENGTH) {
+    return InlineString{value};
+  }
+
+  if (value.size() > _block_remaining) {
+    // Blocks grow with the arena so that small segments do not allocate much while large ones need few blocks.
+    const auto block_size = std::max(value.size(), std::clamp(_allocated_bytes, MIN_BLOCK_SIZE, MAX_BLOCK_SIZE));
+    _blocks.emplace_back(std::make_unique_for_overwrite<char[]>(block_size));
+    _block_position = _blocks.back().get();
+    _block_remaining = block_size;
+    _allocated_bytes += block_size;
+  }
+
+  std::memcpy(_block_position, value.data(), value.size());
+  const auto stored_value = InlineString{std::string_view{_block_position, value.size()}};
+  _block_position += value.size();
+  _block_remaining -= value.size();
+  return stored_value;
+}
+
+size_t StringArena::estimate_memory_usage() const {
+  return _allocated_bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <compare>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+// InlineString is a 16-byte string representation similar to the strings of Umbra and DuckDB. Strings of up to
+// INLINE_LENGTH characters are stored directly in the object. Longer strings store their first PREFIX_LENGTH
+// characters next to a pointer to the full string, which is owned by someone else, usually a StringArena. Since the
+// length and the prefix are always stored inline, most comparisons are decided without dereferencing the pointer.
+class InlineString {
+ public:
+  static constexpr auto INLINE_LENGTH = size_t{12};
+  static constexpr auto PREFIX_LENGTH = size_t{4};
+
+  InlineString() = default;
+
+  // Creates an InlineString for value. If value is longer than INLINE_LENGTH, the InlineString references the
+  // characters of value, which have to outlive it.
+  explicit InlineString(const std::string_view value);
+
+  // Returns the number of characters.
+  size_t size() const;
+
+  // Returns whether the characters are stored in the object itself.
+  bool is_inlined() const;
+
+  // Returns a pointer to the characters. The characters are not null-terminated.
+  const char* data() const;
+
+  operator std::string_view() const;  // NOLINT(google-explicit-constructor)
+
+  friend bool operator==(const InlineString& lhs, const InlineString& rhs);
+  friend std::strong_ordering operator<=>(const InlineString& lhs, const InlineString& rhs);
+
+  friend bool operator==(const InlineString& lhs, const std::string_view rhs);
+  friend std::strong_ordering operator<=>(const InlineString& lhs, const std::string_view rhs);
+
+ private:
+  uint32_t _length{0};
+  std::array<char, PREFIX_LENGTH> _prefix{};
+  // Inlined strings store their characters after the prefix in _suffix, long strings store a pointer to all of their
+  // characters. Unused characters are zero so that inlined strings can be compared bytewise.
+  union {
+    std::array<char, INLINE_LENGTH - PREFIX_LENGTH> _suffix{};
+    const char* _characters;
+  };
+};
+
+static_assert(sizeof(InlineString) == 16, "InlineString is expected to be 16 bytes.");
+
+// StringArena owns the characters of long InlineStrings. Characters are copied into blocks that are never moved or
+// freed while the arena lives, so the InlineStrings it creates stay valid even if the arena itself is moved.
+class StringArena {
+ public:
+  // Returns an InlineString for value. Strings longer than InlineString::INLINE_LENGTH are copied into the arena.
+  InlineString store(const std::string_view value);
+
+  // Returns the number of bytes allocated for characters.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  static constexpr auto MIN_BLOCK_SIZE = size_t{1024};
+  static constexpr auto MAX_BLOCK_SIZE = size_t{64 * 1024};
+
+  std::vector<std::unique_ptr<char[]>> _blocks;
+  char* _block_position{nullptr};
+  size_t _block_remaining{0};
+  size_t _allocated_bytes{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,227 @@
+#include "lz_segment.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <span>
+
+#include "dictionary_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/lz_compression.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::atomic<uint64_t> next_segment_id{1};
+
+// Per-thread cache of decompressed blocks. Entries are replaced round-robin.
+template <typename T>
+struct BlockCache {
+  struct Entry {
+    uint64_t segment_id{0};
+    size_t block_index{0};
+    std::shared_ptr<const std::vector<T>> values;
+  };
+
+  std::array<Entry, LZSegment<T>::CACHED_BLOCKS_PER_THREAD> entries;
+  size_t next_victim{0};
+};
+
+template <typename T>
+BlockCache<T>& thread_block_cache() {
+  thread_local auto cache = BlockCache<T>{};
+  return cache;
+}
+
+// Fixed-size values are serialized as their raw bytes.
+template <typename T>
+std::vector<char> serialize_values(std::span<const T> values) {
+  auto bytes = std::vector<char>(values.size() * sizeof(T));
+  std::memcpy(bytes.data(), values.data(), bytes.size());
+  return bytes;
+}
+
+template <typename T>
+std::vector<T> deserialize_values(std::span<const char> bytes, const size_t value_count) {
+  Assert(bytes.size() == value_count * sizeof(T), "Unexpected size of decompressed LZ block.");
+  auto values = std::vector<T>(value_count);
+  std::memcpy(values.data(), bytes.data(), bytes.size());
+  return values;
+}
+
+// Strings are serialized as the lengths of all strings followed by their concatenated characters.
+template <>
+std::vector<char> serialize_values<std::string>(std::span<const std::string> values) {
+  auto bytes = std::vector<char>(values.size() * sizeof(uint32_t));
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    const auto length = static_cast<uint32_t>(values[index].size());
+    std::memcpy(bytes.data() + index * sizeof(uint32_t), &length, sizeof(uint32_t));
+  }
+  for (const auto& value : values) {
+    bytes.insert(bytes.end(), value.begin(), value.end());
+  }
+  return bytes;
+}
+
+template <>
+std::vector<std::string> deserialize_values<std::string>(std::span<const char> bytes, const size_t value_count) {
+  Assert(bytes.size() >= value_count * sizeof(uint32_t), "Unexpected size of decompressed LZ block.");
+  auto values = std::vector<std::string>(value_count);
+  auto character_offset = value_count * sizeof(uint32_t);
+  for (auto index = size_t{0}; index < value_count; ++index) {
+    auto length = uint32_t{0};
+    std::memcpy(&length, bytes.data() + index * sizeof(uint32_t), sizeof(uint32_t));
+    Assert(character_offset + length <= bytes.size(), "Unexpected size of decompressed LZ block.");
+    values[index].assign(bytes.data() + character_offset, length);
+    character_offset += length;
+  }
+  return values;
+}
+
+}  // namespace
+
+template <typename T>
+LZSegment<T>::LZSegment(const std::shared_ptr<AbstractSegment>& abstract_segment)
+    : _size{abstract_segment->size()}, _segment_id{next_segment_id++} {
+  // Values of ValueSegments are compressed in place, DictionarySegments are decoded first.
+  auto values = std::span<const T>{};
+  auto decoded_values = std::vector<T>{};
+  if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment)) {
+    _is_nullable = value_segment->is_nullable();
+    if (_is_nullable) {
+      _null_values = value_segment->null_values();
+    }
+    if constexpr (std::is_same_v<T, std::string>) {
+      // InlineStrings are materialized so that blocks store the characters rather than pointers to them.
+      decoded_values.assign(value_segment->values().begin(), value_segment->values().end());
+      values = decoded_values;
+    } else {
+      values = value_segment->values();
+    }
+  } else if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(abstract_segment)) {
+    _is_nullable = dictionary_segment->null_value_id() != INVALID_VALUE_ID;
+    if (_is_nullable) {
+      _null_values.resize(_size);
+    }
+    decoded_values.resize(_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+      if (const auto value = dictionary_segment->get_typed_value(chunk_offset)) {
+        decoded_values[chunk_offset] = *value;
+      } else {
+        _null_values.set(chunk_offset);
+      }
+    }
+    values = decoded_values;
+  } else {
+    Fail("Tried to create LZSegment<T> from abstract segment that was not ValueSegment<T> or DictionarySegment<T>.");
+  }
+
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_offsets.reserve(block_count + 1);
+  _uncompressed_block_sizes.reserve(block_count);
+  for (auto block_begin = ChunkOffset{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+    const auto serialized_block = serialize_values<T>(values.subspan(block_begin, block_end - block_begin));
+    const auto compressed_block = lz_compress(serialized_block);
+
+    _block_offsets.emplace_back(_compressed_data.size());
+    _uncompressed_block_sizes.emplace_back(serialized_block.size());
+    _compressed_data.insert(_compressed_data.end(), compressed_block.begin(), compressed_block.end());
+  }
+  _block_offsets.emplace_back(_compressed_data.size());
+  _compressed_data.shrink_to_fit();
+}
+
+template <typename T>
+AllTypeVariant LZSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (const auto optional_value = get_typed_value(chunk_offset)) {
+    return *optional_value;
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+bool LZSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  return is_nullable() && _null_values[chunk_offset];
+}
+
+template <typename T>
+T LZSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  Assert(optional_value.has_value(),
+         "Tried to `.get` value at offset " + std::to_string(chunk_offset) + " that was NULL.");
+  return *optional_value;
+}
+
+template <typename T>
+std::optional<T> LZSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < _size, "Tried to access LZSegment out of bounds.");
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+  return (*decompressed_block(chunk_offset / BLOCK_SIZE))[chunk_offset % BLOCK_SIZE];
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> LZSegment<T>::decompressed_block(const size_t block_index) const {
+  Assert(block_index < block_count(), "Tried to decompress block of LZSegment out of bounds.");
+
+  auto& cache = thread_block_cache<T>();
+  for (const auto& entry : cache.entries) {
+    if (entry.segment_id == _segment_id && entry.block_index == block_index) {
+      return entry.values;
+    }
+  }
+
+  auto& victim = cache.entries[cache.next_victim];
+  cache.next_victim = (cache.next_victim + 1) % CACHED_BLOCKS_PER_THREAD;
+  victim.segment_id = _segment_id;
+  victim.block_index = block_index;
+  victim.values = std::make_shared<const std::vector<T>>(_decompress_block(block_index));
+  return victim.values;
+}
+
+template <typename T>
+std::vector<T> LZSegment<T>::_decompress_block(const size_t block_index) const {
+  const auto compressed_begin = _compressed_data.data() + _block_offsets[block_index];
+  const auto compressed_end = _compressed_data.data() + _block_offsets[block_index + 1];
+  auto serialized_block = std::vector<char>(_uncompressed_block_sizes[block_index]);
+  lz_decompress(std::span<const char>{compressed_begin, compressed_end}, serialized_block);
+
+  const auto block_begin = static_cast<ChunkOffset>(block_index * BLOCK_SIZE);
+  const auto value_count = std::min(BLOCK_SIZE, _size - block_begin);
+  return deserialize_values<T>(serialized_block, value_count);
+}
+
+template <typename T>
+size_t LZSegment<T>::block_count() const {
+  return _uncompressed_block_sizes.size();
+}
+
+template <typename T>
+bool LZSegment<T>::is_nullable() const {
+  return _is_nullable;
+}
+
+template <typename T>
+const Bitmap& LZSegment<T>::null_values() const {
+  Assert(is_nullable(), "Tried to get null_values of non-nullable LZSegment.");
+  return _null_values;
+}
+
+template <typename T>
+ChunkOffset LZSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+size_t LZSegment<T>::estimate_memory_usage() const {
+  return _compressed_data.size() + _block_offsets.size() * sizeof(size_t) +
+         _uncompressed_block_sizes.size() * sizeof(size_t) + _null_values.estimate_memory_usage();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(LZSegment);
+
+}  // namespace opossum
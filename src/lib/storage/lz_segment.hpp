@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_segment.hpp"
+#include "bitmap.hpp"
+
+namespace opossum {
+
+// LZSegment is a heavyweight segment type for rarely accessed (cold) data. Values are split into blocks of BLOCK_SIZE
+// values, serialized, and compressed with the LZ codec from utils/lz_compression.hpp. Blocks are only decompressed
+// when they are accessed. Decompressed blocks are kept in a small per-thread cache, so that accessing values of the
+// same block repeatedly (e.g., through operator[]) does not decompress the block each time.
+template <typename T>
+class LZSegment : public AbstractSegment {
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{4096};
+
+  // Number of decompressed blocks that each thread caches across all LZSegments of the same data type.
+  static constexpr auto CACHED_BLOCKS_PER_THREAD = size_t{8};
+
+  /**
+   * Creates an LZ segment from a given value segment or dictionary segment.
+   */
+  explicit LZSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. This might decompress the surrounding block. If you want to write
+  // efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns the decompressed values of the given block, using the calling thread's block cache. NULL values are
+  // decompressed as default-constructed values.
+  std::shared_ptr<const std::vector<T>> decompressed_block(const size_t block_index) const;
+
+  // Returns the number of blocks.
+  size_t block_count() const;
+
+  // Returns whether segment supports NULL values.
+  bool is_nullable() const;
+
+  // Returns NULL value bitmap that indicates whether a value is NULL with true at position i. Throws an exception if
+  // is_nullable() returns false.
+  const Bitmap& null_values() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage of the compressed data. Cached blocks are not included.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::vector<T> _decompress_block(const size_t block_index) const;
+
+  std::vector<char> _compressed_data;
+  // The compressed block i is stored in _compressed_data[_block_offsets[i], _block_offsets[i + 1]).
+  std::vector<size_t> _block_offsets;
+  std::vector<size_t> _uncompressed_block_sizes;
+  Bitmap _null_values;
+  ChunkOffset _size;
+  bool _is_nullable;
+
+  // Identifies the segment in the block caches. Unlike the segment's address, it is never reused.
+  uint64_t _segment_id;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(LZSegment);
+
+}  // namespace opossum
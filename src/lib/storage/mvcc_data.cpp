@@ -0,0 +1,143 @@
+#include "mvcc_data.hpp"
+
+#include <bit>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MvccData::~MvccData() {
+  for (auto& block : _blocks) {
+    delete[] block.load();
+  }
+  for (auto& words : _invalidated_words) {
+    delete[] words.load();
+  }
+}
+
+ChunkOffset MvccData::size() const {
+  // Synchronizes with the release store in grow, so that the rows' blocks are visible.
+  return _size.load(std::memory_order_acquire);
+}
+
+void MvccData::grow(const ChunkOffset size) {
+  const auto old_size = _size.load(std::memory_order_relaxed);
+  if (size <= old_size) {
+    return;
+  }
+
+  // Allocates all blocks up to the one holding the last row. They are published by the release store of the size.
+  const auto last_block_index = _locate(size - 1).first;
+  for (auto block_index = size_t{0}; block_index <= last_block_index; ++block_index) {
+    if (!_blocks[block_index].load(std::memory_order_relaxed)) {
+      const auto block_size = FIRST_BLOCK_SIZE << block_index;
+      _blocks[block_index].store(new RowVersion[block_size], std::memory_order_relaxed);
+      _invalidated_words[block_index].store(new std::atomic<uint64_t>[block_size / 64](), std::memory_order_relaxed);
+    }
+  }
+  _size.store(size, std::memory_order_release);
+}
+
+CommitID MvccData::begin_commit_id(const ChunkOffset chunk_offset) const {
+  return _row(chunk_offset).begin_commit_id.load();
+}
+
+void MvccData::set_begin_commit_id(const ChunkOffset chunk_offset, const CommitID commit_id) {
+  _row(chunk_offset).begin_commit_id.store(commit_id);
+}
+
+CommitID MvccData::end_commit_id(const ChunkOffset chunk_offset) const {
+  return _row(chunk_offset).end_commit_id.load();
+}
+
+void MvccData::set_end_commit_id(const ChunkOffset chunk_offset, const CommitID commit_id) {
+  _row(chunk_offset).end_commit_id.store(commit_id);
+}
+
+TransactionID MvccData::transaction_id(const ChunkOffset chunk_offset) const {
+  return _row(chunk_offset).transaction_id.load();
+}
+
+void MvccData::set_transaction_id(const ChunkOffset chunk_offset, const TransactionID transaction_id) {
+  _row(chunk_offset).transaction_id.store(transaction_id);
+}
+
+bool MvccData::compare_exchange_transaction_id(const ChunkOffset chunk_offset, TransactionID& expected,
+                                               const TransactionID desired) {
+  return _row(chunk_offset).transaction_id.compare_exchange_strong(expected, desired);
+}
+
+void MvccData::copy_row(const ChunkOffset chunk_offset, const MvccData& source, const ChunkOffset source_chunk_offset) {
+  set_begin_commit_id(chunk_offset, source.begin_commit_id(source_chunk_offset));
+  set_end_commit_id(chunk_offset, source.end_commit_id(source_chunk_offset));
+  set_transaction_id(chunk_offset, source.transaction_id(source_chunk_offset));
+}
+
+bool MvccData::is_visible(const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                          const CommitID snapshot_commit_id) const {
+  if (chunk_offset >= size()) {
+    return false;
+  }
+  const auto& row = _row(chunk_offset);
+  const auto begin_commit_id = row.begin_commit_id.load();
+  const auto end_commit_id = row.end_commit_id.load();
+  const auto row_transaction_id = row.transaction_id.load();
+
+  // Rows inserted by the transaction itself are not committed yet, i.e., their begin commit id is MAX_COMMIT_ID.
+  const auto is_own_insert = row_transaction_id == transaction_id && begin_commit_id == MAX_COMMIT_ID &&
+                             end_commit_id == MAX_COMMIT_ID && transaction_id != INVALID_TRANSACTION_ID;
+  // Rows that the transaction is deleting are held by it, but they are visible to other transactions until the delete
+  // is committed.
+  const auto is_past_insert = (row_transaction_id != transaction_id || transaction_id == INVALID_TRANSACTION_ID) &&
+                              begin_commit_id <= snapshot_commit_id && snapshot_commit_id < end_commit_id;
+  return is_own_insert || is_past_insert;
+}
+
+void MvccData::invalidate(const ChunkOffset chunk_offset) {
+  const auto mask = uint64_t{1} << (chunk_offset % 64);
+  if (!(_invalidated_word(chunk_offset).fetch_or(mask) & mask)) {
+    ++_invalidated_row_count;
+  }
+}
+
+bool MvccData::is_invalidated(const ChunkOffset chunk_offset) const {
+  return (_invalidated_word(chunk_offset).load() >> (chunk_offset % 64)) & 1;
+}
+
+ChunkOffset MvccData::invalidated_row_count() const {
+  return _invalidated_row_count;
+}
+
+size_t MvccData::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this);
+  for (auto block_index = size_t{0}; block_index < BLOCK_COUNT; ++block_index) {
+    if (_blocks[block_index].load()) {
+      const auto block_size = FIRST_BLOCK_SIZE << block_index;
+      memory_usage += block_size * sizeof(RowVersion) + block_size / 8;
+    }
+  }
+  return memory_usage;
+}
+
+std::pair<size_t, size_t> MvccData::_locate(const ChunkOffset chunk_offset) {
+  // Block i starts at index FIRST_BLOCK_SIZE * (2^i - 1). Thus, the block of an index is given by the highest set bit
+  // of index + FIRST_BLOCK_SIZE.
+  const auto index = uint64_t{chunk_offset} + FIRST_BLOCK_SIZE;
+  const auto block_index = static_cast<size_t>(std::bit_width(index) - 1 - FIRST_BLOCK_SIZE_BITS);
+  return {block_index, index - (FIRST_BLOCK_SIZE << block_index)};
+}
+
+MvccData::RowVersion& MvccData::_row(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Tried to access MvccData out of bounds.");
+  const auto [block_index, block_offset] = _locate(chunk_offset);
+  return _blocks[block_index].load(std::memory_order_relaxed)[block_offset];
+}
+
+std::atomic<uint64_t>& MvccData::_invalidated_word(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Tried to access MvccData out of bounds.");
+  // Blocks start at multiples of 64 rows, so that the bits of a word belong to the same block.
+  const auto [block_index, block_offset] = _locate(chunk_offset);
+  return _invalidated_words[block_index].load(std::memory_order_relaxed)[block_offset / 64];
+}
+
+}  // namespace opossum
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// MvccData stores the versioning information of each row of a chunk for multi-version concurrency control: the commit
+// id of the transaction that inserted the row (begin), the commit id of the transaction that deleted it (end), and
+// the id of the transaction that currently holds the row. Rows that were not committed yet have a begin commit id of
+// MAX_COMMIT_ID, rows that were not deleted an end commit id of MAX_COMMIT_ID. Like the chunk directory, the rows are
+// allocated in blocks of doubling size that are never moved, so that readers can access rows without locks while a
+// writer grows the data. Growing has to be serialized by the caller (see Table::_chunk_mutex). The versioning
+// information is shared by all versions of a chunk, e.g., by a delta chunk and the main chunk it was merged into.
+//
+// Additionally, a bitmap marks the invalidated rows, i.e., rows whose deletion was committed and rows whose insertion
+// was rolled back. They are not visible to new transactions.
+class MvccData : private Noncopyable {
+ public:
+  MvccData() = default;
+
+  ~MvccData();
+
+  // Returns the number of rows that have versioning information.
+  ChunkOffset size() const;
+
+  // Adds uncommitted rows until the data holds size rows.
+  void grow(const ChunkOffset size);
+
+  CommitID begin_commit_id(const ChunkOffset chunk_offset) const;
+  void set_begin_commit_id(const ChunkOffset chunk_offset, const CommitID commit_id);
+
+  CommitID end_commit_id(const ChunkOffset chunk_offset) const;
+  void set_end_commit_id(const ChunkOffset chunk_offset, const CommitID commit_id);
+
+  TransactionID transaction_id(const ChunkOffset chunk_offset) const;
+  void set_transaction_id(const ChunkOffset chunk_offset, const TransactionID transaction_id);
+
+  // Sets the transaction id of the row to desired if it is expected, which allows only one transaction to delete a row.
+  // Otherwise, expected is set to the current transaction id. Returns whether the transaction id was set.
+  bool compare_exchange_transaction_id(const ChunkOffset chunk_offset, TransactionID& expected,
+                                       const TransactionID desired);
+
+  // Copies the versioning information of a row, e.g., when the row is moved to another chunk.
+  void copy_row(const ChunkOffset chunk_offset, const MvccData& source, const ChunkOffset source_chunk_offset);
+
+  // Returns whether the row is visible to the transaction with the given id and snapshot: Either the transaction
+  // inserted the row itself and did not delete it, or another transaction inserted the row before the snapshot and it
+  // was not deleted before the snapshot. Rows without versioning information are not visible.
+  bool is_visible(const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                  const CommitID snapshot_commit_id) const;
+
+  // Marks the row as invalidated.
+  void invalidate(const ChunkOffset chunk_offset);
+
+  bool is_invalidated(const ChunkOffset chunk_offset) const;
+
+  // Returns the number of invalidated rows.
+  ChunkOffset invalidated_row_count() const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  struct RowVersion {
+    std::atomic<CommitID> begin_commit_id{MAX_COMMIT_ID};
+    std::atomic<CommitID> end_commit_id{MAX_COMMIT_ID};
+    std::atomic<TransactionID> transaction_id{INVALID_TRANSACTION_ID};
+  };
+
+  // Block i holds FIRST_BLOCK_SIZE * 2^i rows, which suffices for all ChunkOffsets with BLOCK_COUNT blocks.
+  static constexpr auto FIRST_BLOCK_SIZE_BITS = 10;
+  static constexpr auto FIRST_BLOCK_SIZE = uint64_t{1} << FIRST_BLOCK_SIZE_BITS;
+  static constexpr auto BLOCK_COUNT = size_t{sizeof(ChunkOffset) * 8 - FIRST_BLOCK_SIZE_BITS + 1};
+
+  // Returns the block and the offset within the block of a row.
+  static std::pair<size_t, size_t> _locate(const ChunkOffset chunk_offset);
+
+  RowVersion& _row(const ChunkOffset chunk_offset) const;
+
+  std::atomic<uint64_t>& _invalidated_word(const ChunkOffset chunk_offset) const;
+
+  std::array<std::atomic<RowVersion*>, BLOCK_COUNT> _blocks{};
+  // The invalidation bitmap of each block, stored in 64-bit words.
+  std::array<std::atomic<std::atomic<uint64_t>*>, BLOCK_COUNT> _invalidated_words{};
+  std::atomic<ChunkOffset> _size{0};
+  std::atomic<ChunkOffset> _invalidated_row_count{0};
+};
+
+}  // namespace opossum
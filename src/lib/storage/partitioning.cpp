@@ -0,0 +1,123 @@
+#include "partitioning.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractPartitioning::AbstractPartitioning(const ColumnID column_id) : _column_id{column_id} {}
+
+ColumnID AbstractPartitioning::column_id() const {
+  return _column_id;
+}
+
+template <typename T>
+HashPartitioning<T>::HashPartitioning(const ColumnID column_id, const PartitionID partition_count)
+    : AbstractPartitioning{column_id}, _partition_count{partition_count} {
+  Assert(partition_count > 0, "Hash partitioning needs at least one partition.");
+}
+
+template <typename T>
+PartitionID HashPartitioning<T>::partition_count() const {
+  return _partition_count;
+}
+
+template <typename T>
+PartitionID HashPartitioning<T>::partition(const AllTypeVariant& value) const {
+  if (variant_is_null(value)) {
+    return PartitionID{0};
+  }
+  return _partition_id(type_cast<T>(value));
+}
+
+template <typename T>
+bool HashPartitioning<T>::may_match(const PartitionID partition_id, const ScanType scan_type,
+                                    const AllTypeVariant& search_value) const {
+  if (variant_is_null(search_value)) {
+    return false;
+  }
+  return scan_type != ScanType::OpEquals || _partition_id(type_cast<T>(search_value)) == partition_id;
+}
+
+template <typename T>
+PartitionID HashPartitioning<T>::_partition_id(const T& value) const {
+  // std::hash is the identity for integers in libstdc++, so consecutive keys would end up in consecutive partitions.
+  // Multiplying with 2^64 / phi (Fibonacci hashing) spreads them into the upper bits.
+  const auto hash = static_cast<uint64_t>(std::hash<T>{}(value)) * 0x9E3779B97F4A7C15ULL;
+  return static_cast<PartitionID>((hash >> 32) % _partition_count);
+}
+
+template <typename T>
+RangePartitioning<T>::RangePartitioning(const ColumnID column_id, const std::vector<AllTypeVariant>& bounds)
+    : AbstractPartitioning{column_id} {
+  Assert(bounds.size() < std::numeric_limits<PartitionID::base_type>::max(), "Too many range partitions.");
+  _bounds.reserve(bounds.size());
+  for (const auto& bound : bounds) {
+    Assert(!variant_is_null(bound), "Range partition bounds must not be NULL.");
+    _bounds.emplace_back(type_cast<T>(bound));
+  }
+  Assert(std::ranges::adjacent_find(_bounds, [](const T& lhs, const T& rhs) { return !(lhs < rhs); }) == _bounds.end(),
+         "Range partition bounds must be strictly ascending.");
+}
+
+template <typename T>
+PartitionID RangePartitioning<T>::partition_count() const {
+  return static_cast<PartitionID>(_bounds.size() + 1);
+}
+
+template <typename T>
+PartitionID RangePartitioning<T>::partition(const AllTypeVariant& value) const {
+  if (variant_is_null(value)) {
+    return PartitionID{0};
+  }
+  return _partition_id(type_cast<T>(value));
+}
+
+template <typename T>
+bool RangePartitioning<T>::may_match(const PartitionID partition_id, const ScanType scan_type,
+                                     const AllTypeVariant& search_value) const {
+  if (variant_is_null(search_value)) {
+    return false;
+  }
+  const auto value = type_cast<T>(search_value);
+  // The partition holds values in [lower, upper), where the first partition has no lower and the last no upper bound.
+  const auto has_lower = partition_id > 0;
+  const auto has_upper = partition_id < _bounds.size();
+  const auto& lower = has_lower ? _bounds[partition_id - 1] : value;
+  const auto& upper = has_upper ? _bounds[partition_id] : value;
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _partition_id(value) == partition_id;
+    case ScanType::OpNotEquals:
+      return true;
+    case ScanType::OpLessThan:
+      return !has_lower || lower < value;
+    case ScanType::OpLessThanEquals:
+      return !has_lower || !(value < lower);
+    case ScanType::OpGreaterThan:
+    case ScanType::OpGreaterThanEquals:
+      return !has_upper || value < upper;
+    default:
+      Fail("Invalid Scan type.");
+  }
+}
+
+template <typename T>
+const std::vector<T>& RangePartitioning<T>::bounds() const {
+  return _bounds;
+}
+
+template <typename T>
+PartitionID RangePartitioning<T>::_partition_id(const T& value) const {
+  return static_cast<PartitionID>(std::ranges::upper_bound(_bounds, value) - _bounds.begin());
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(HashPartitioning);
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RangePartitioning);
+
+}  // namespace opossum
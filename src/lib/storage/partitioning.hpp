@@ -0,0 +1,82 @@
+#pragma once
+
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// A partitioning assigns each row of a table to a partition by the value of one column (see Table::partition_by_hash
+// and Table::partition_by_range). Each partition has its own chunks, so that scans can skip all chunks of partitions
+// that cannot contain qualifying rows, and partitions can be processed independently. NULL values are assigned to the
+// first partition.
+class AbstractPartitioning : private Noncopyable {
+ public:
+  explicit AbstractPartitioning(const ColumnID column_id);
+
+  virtual ~AbstractPartitioning() = default;
+
+  // Returns the column whose values determine the partitions.
+  ColumnID column_id() const;
+
+  virtual PartitionID partition_count() const = 0;
+
+  // Returns the partition of a row with the given value in the partitioning column.
+  virtual PartitionID partition(const AllTypeVariant& value) const = 0;
+
+  // Returns false if no row of the partition can satisfy `value <scan_type> search_value` and true otherwise.
+  virtual bool may_match(const PartitionID partition_id, const ScanType scan_type,
+                         const AllTypeVariant& search_value) const = 0;
+
+ protected:
+  const ColumnID _column_id;
+};
+
+// Assigns rows to partitions by the hash of their value, which spreads the rows evenly. Only equality predicates can
+// skip partitions.
+template <typename T>
+class HashPartitioning : public AbstractPartitioning {
+ public:
+  HashPartitioning(const ColumnID column_id, const PartitionID partition_count);
+
+  PartitionID partition_count() const final;
+
+  PartitionID partition(const AllTypeVariant& value) const final;
+
+  bool may_match(const PartitionID partition_id, const ScanType scan_type,
+                 const AllTypeVariant& search_value) const final;
+
+ protected:
+  PartitionID _partition_id(const T& value) const;
+
+  const PartitionID _partition_count;
+};
+
+// Assigns rows to partitions by ranges of their values. Given n ascending bounds, partition 0 holds values smaller than
+// the first bound, partition i holds values in [bounds[i - 1], bounds[i]), and partition n holds values not smaller
+// than the last bound.
+template <typename T>
+class RangePartitioning : public AbstractPartitioning {
+ public:
+  RangePartitioning(const ColumnID column_id, const std::vector<AllTypeVariant>& bounds);
+
+  PartitionID partition_count() const final;
+
+  PartitionID partition(const AllTypeVariant& value) const final;
+
+  bool may_match(const PartitionID partition_id, const ScanType scan_type,
+                 const AllTypeVariant& search_value) const final;
+
+  const std::vector<T>& bounds() const;
+
+ protected:
+  PartitionID _partition_id(const T& value) const;
+
+  std::vector<T> _bounds;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(HashPartitioning);
+EXPLICITLY_DECLARE_DATA_TYPES(RangePartitioning);
+
+}  // namespace opossum
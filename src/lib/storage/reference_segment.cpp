@@ -8,7 +8,10 @@ namespace opossum {
 
 ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table>& referenced_table,
                                    const ColumnID referenced_column_id, const std::shared_ptr<const PosList>& pos)
-    : _referenced_table{referenced_table}, _referenced_column_id{referenced_column_id}, _pos_list{pos} {}
+    : _referenced_table{referenced_table},
+      _referenced_column_id{referenced_column_id},
+      _pos_list{pos},
+      _chunk_id_pin{referenced_table->pin_chunk_ids()} {}
 
 AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
   return get_by_row_id(_pos_list->at(chunk_offset));
@@ -6,7 +6,8 @@ namespace opossum {
 
 class Table;
 
-// ReferenceSegment is a specific segment type that stores all its values as position list of a referenced column.
+// ReferenceSegment is a specific segment type that stores all its values as position list of a referenced column. It
+// pins the chunk ids of the referenced table (see Table::pin_chunk_ids), so that its positions stay valid.
 class ReferenceSegment : public AbstractSegment {
  public:
   // Creates a reference segment. The parameters specify the positions and the referenced column.
@@ -31,6 +32,7 @@ class ReferenceSegment : public AbstractSegment {
   std::shared_ptr<const Table> _referenced_table;
   ColumnID _referenced_column_id;
   std::shared_ptr<const PosList> _pos_list;
+  std::shared_ptr<const void> _chunk_id_pin;
 };
 
 }  // namespace opossum
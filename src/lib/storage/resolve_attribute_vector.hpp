@@ -0,0 +1,38 @@
+#pragma once
+
+#include "abstract_attribute_vector.hpp"
+#include "bit_packed_integer_vector.hpp"
+#include "fixed_width_integer_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Resolves the concrete type of an attribute vector by passing it on to a generic lambda. Since all concrete attribute
+ * vectors are final, calls inside the lambda (e.g., get() or decode()) are not dispatched virtually, which makes this
+ * the preferred way of accessing attribute vectors in tight loops.
+ *
+ * Example:
+ *
+ *   resolve_attribute_vector(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+ *     for (auto index = size_t{0}; index < attribute_vector.size(); ++index) {
+ *       process(attribute_vector.get(index));
+ *     }
+ *   });
+ */
+template <typename Functor>
+void resolve_attribute_vector(const AbstractAttributeVector& attribute_vector, const Functor& func) {
+  if (const auto fixed_width_8 = dynamic_cast<const FixedWidthIntegerVector<uint8_t>*>(&attribute_vector)) {
+    func(*fixed_width_8);
+  } else if (const auto fixed_width_16 = dynamic_cast<const FixedWidthIntegerVector<uint16_t>*>(&attribute_vector)) {
+    func(*fixed_width_16);
+  } else if (const auto fixed_width_32 = dynamic_cast<const FixedWidthIntegerVector<uint32_t>*>(&attribute_vector)) {
+    func(*fixed_width_32);
+  } else if (const auto bit_packed = dynamic_cast<const BitPackedIntegerVector*>(&attribute_vector)) {
+    func(*bit_packed);
+  } else {
+    Fail("Unknown attribute vector type.");
+  }
+}
+
+}  // namespace opossum
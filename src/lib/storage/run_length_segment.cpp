@@ -0,0 +1,102 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
+  Assert(value_segment, "Tried to create RunLengthSegment<T> from abstract segment that was not ValueSegment<T>.");
+
+  const auto& values = value_segment->values();
+  for (auto value_index = ChunkOffset{0}, size = static_cast<ChunkOffset>(values.size()); value_index < size;
+       ++value_index) {
+    const auto is_null = value_segment->is_null(value_index);
+    const auto continues_run = !_values.empty() && _null_values[_null_values.size() - 1] == is_null &&
+                               (is_null || _values.back() == values[value_index]);
+    if (continues_run) {
+      _end_positions.back() = value_index;
+      continue;
+    }
+
+    // NULL runs store a default-constructed value so that _values, _null_values, and _end_positions stay aligned.
+    _values.emplace_back(is_null ? T{} : T{values[value_index]});
+    _null_values.push_back(is_null);
+    _end_positions.emplace_back(value_index);
+  }
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (const auto optional_value = get_typed_value(chunk_offset)) {
+    return *optional_value;
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  Assert(optional_value.has_value(),
+         "Tried to `.get` value at offset " + std::to_string(chunk_offset) + " that was NULL.");
+  return *optional_value;
+}
+
+template <typename T>
+std::optional<T> RunLengthSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  const auto run_index = _run_index(chunk_offset);
+  if (_null_values[run_index]) {
+    return std::nullopt;
+  }
+  return _values[run_index];
+}
+
+template <typename T>
+const std::vector<T>& RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const Bitmap& RunLengthSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::run_count() const {
+  return static_cast<ChunkOffset>(_end_positions.size());
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::size() const {
+  if (_end_positions.empty()) {
+    return 0;
+  }
+  return _end_positions.back() + 1;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return _values.size() * sizeof(T) + _end_positions.size() * sizeof(ChunkOffset) +
+         _null_values.estimate_memory_usage();
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::_run_index(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Tried to access RunLengthSegment out of bounds.");
+  // The first run whose last row is not before the given offset contains that offset.
+  const auto run = std::lower_bound(_end_positions.cbegin(), _end_positions.cend(), chunk_offset);
+  return static_cast<size_t>(std::distance(_end_positions.cbegin(), run));
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_segment.hpp"
+#include "bitmap.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is a specific segment type that stores consecutive equal values (runs) only once. For each run, it
+// holds the value, whether the value is NULL, and the chunk offset of the run's last row.
+template <typename T>
+class RunLengthSegment : public AbstractSegment {
+ public:
+  /**
+   * Creates a RunLength segment from a given value segment.
+   */
+  explicit RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns the value of each run.
+  const std::vector<T>& values() const;
+
+  // Returns whether each run consists of NULL values.
+  const Bitmap& null_values() const;
+
+  // Returns the chunk offset of the last row of each run. The first run starts at offset 0, every other run right after
+  // the end of its predecessor.
+  const std::vector<ChunkOffset>& end_positions() const;
+
+  // Returns the number of runs.
+  ChunkOffset run_count() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // Returns the index of the run that contains the given chunk offset.
+  size_t _run_index(const ChunkOffset chunk_offset) const;
+
+  std::vector<T> _values;
+  Bitmap _null_values;
+  std::vector<ChunkOffset> _end_positions;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
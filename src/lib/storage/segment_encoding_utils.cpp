@@ -0,0 +1,72 @@
+#include "segment_encoding_utils.hpp"
+
+#include "delta_encoded_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "gorilla_segment.hpp"
+#include "lz_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "unsorted_dictionary_segment.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+std::shared_ptr<AbstractSegment> encode_segment(const std::string& data_type,
+                                                const std::shared_ptr<AbstractSegment>& value_segment,
+                                                const SegmentEncodingSpec& encoding_spec) {
+  auto encoded_segment = std::shared_ptr<AbstractSegment>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using DataType = typename decltype(type)::type;
+    if (encoding_spec.encoding_type == EncodingType::Dictionary) {
+      encoded_segment =
+          std::make_shared<DictionarySegment<DataType>>(value_segment, encoding_spec.vector_compression_type);
+      return;
+    }
+
+    // Only DictionarySegments can be built from the UnsortedDictionarySegments of a delta store directly.
+    auto source_segment = value_segment;
+    if (const auto unsorted_segment = std::dynamic_pointer_cast<UnsortedDictionarySegment<DataType>>(value_segment)) {
+      source_segment = unsorted_segment->materialize();
+    }
+
+    switch (encoding_spec.encoding_type) {
+      case EncodingType::Dictionary:
+        Fail("Dictionary encoding is handled above.");
+      case EncodingType::RunLength:
+        encoded_segment = std::make_shared<RunLengthSegment<DataType>>(source_segment);
+        return;
+      case EncodingType::FrameOfReference:
+        if constexpr (std::is_integral_v<DataType>) {
+          encoded_segment = std::make_shared<FrameOfReferenceSegment<DataType>>(source_segment);
+          return;
+        } else {
+          Fail("FrameOfReference encoding is only supported for integer columns.");
+        }
+      case EncodingType::Delta:
+        if constexpr (std::is_integral_v<DataType>) {
+          encoded_segment = std::make_shared<DeltaEncodedSegment<DataType>>(source_segment);
+          return;
+        } else {
+          Fail("Delta encoding is only supported for integer columns.");
+        }
+      case EncodingType::Gorilla:
+        if constexpr (std::is_floating_point_v<DataType>) {
+          encoded_segment = std::make_shared<GorillaSegment<DataType>>(source_segment);
+          return;
+        } else {
+          Fail("Gorilla encoding is only supported for floating-point columns.");
+        }
+      case EncodingType::LZ:
+        encoded_segment = std::make_shared<LZSegment<DataType>>(source_segment);
+        return;
+    }
+    Fail("Unknown encoding type.");
+  });
+
+  Assert(encoded_segment, "Could not encode segment of unknown data type " + data_type + ".");
+  return encoded_segment;
+}
+
+}  // namespace opossum
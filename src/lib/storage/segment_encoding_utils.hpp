@@ -0,0 +1,18 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// Creates a segment with the encoding described by encoding_spec from the given ValueSegment or
+// UnsortedDictionarySegment of the given data type. LZ encoding also accepts DictionarySegments.
+std::shared_ptr<AbstractSegment> encode_segment(const std::string& data_type,
+                                                const std::shared_ptr<AbstractSegment>& value_segment,
+                                                const SegmentEncodingSpec& encoding_spec);
+
+}  // namespace opossum
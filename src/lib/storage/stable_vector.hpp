@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+// StableVector is a contiguous, append-only vector whose elements can be read without locks while a single writer
+// appends to it, e.g., by scans of a table's mutable chunks. When the capacity is exhausted, the elements are copied
+// into a buffer of twice the size, but the previous buffers are kept until the vector is destroyed, so that readers
+// that still use them never access freed memory. The size is published with a release store after the elements have
+// been written. Thus, readers that got the size first (see span()) only access completely written elements. Writers,
+// i.e., all non-const methods, have to be serialized by the caller and must only change elements that have not been
+// published yet if readers may access them.
+template <typename T>
+class StableVector {
+  static_assert(std::is_trivially_copyable_v<T>, "StableVector copies its elements bytewise when it grows.");
+
+ public:
+  StableVector() = default;
+
+  StableVector(const StableVector& other) {
+    _append(other.span());
+  }
+
+  StableVector(StableVector&& other) noexcept
+      : _buffers{std::move(other._buffers)},
+        _data{other._data.exchange(nullptr, std::memory_order_relaxed)},
+        _size{other._size.exchange(0, std::memory_order_relaxed)},
+        _capacity{std::exchange(other._capacity, 0)} {}
+
+  StableVector& operator=(const StableVector& other) {
+    if (this != &other) {
+      *this = StableVector(other);
+    }
+    return *this;
+  }
+
+  StableVector& operator=(StableVector&& other) noexcept {
+    _buffers = std::move(other._buffers);
+    _data.store(other._data.exchange(nullptr, std::memory_order_relaxed), std::memory_order_release);
+    _size.store(other._size.exchange(0, std::memory_order_relaxed), std::memory_order_release);
+    _capacity = std::exchange(other._capacity, 0);
+    return *this;
+  }
+
+  // Returns the number of published elements.
+  size_t size() const {
+    // Synchronizes with the release store in the writers, so that the elements are visible.
+    return _size.load(std::memory_order_acquire);
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  // Returns the published elements. The size is loaded before the buffer, so that the buffer holds all of them.
+  std::span<const T> span() const {
+    const auto size = this->size();
+    return {_data.load(std::memory_order_acquire), size};
+  }
+
+  // Returns the current buffer. Writers may replace it when they grow the vector.
+  const T* data() const {
+    return _data.load(std::memory_order_acquire);
+  }
+
+  T* data() {
+    return _data.load(std::memory_order_relaxed);
+  }
+
+  const T& operator[](const size_t index) const {
+    return data()[index];
+  }
+
+  T& operator[](const size_t index) {
+    return data()[index];
+  }
+
+  const T& back() const {
+    return (*this)[size() - 1];
+  }
+
+  T& back() {
+    return (*this)[size() - 1];
+  }
+
+  // Adds an element at the end and publishes it.
+  void push_back(const T& value) {
+    const auto size = _size.load(std::memory_order_relaxed);
+    if (size == _capacity) {
+      _grow(size + 1);
+    }
+    data()[size] = value;
+    _size.store(size + 1, std::memory_order_release);
+  }
+
+  // Adds the values at the end and publishes them at once.
+  void append(const std::span<const T> values) {
+    _append(values);
+  }
+
+  // Resizes the vector. New elements are set to value. Shrinking keeps the buffers.
+  void resize(const size_t size, const T& value = T{}) {
+    const auto old_size = _size.load(std::memory_order_relaxed);
+    if (size > _capacity) {
+      _grow(size);
+    }
+    std::fill(data() + std::min(old_size, size), data() + size, value);
+    _size.store(size, std::memory_order_release);
+  }
+
+  void reserve(const size_t capacity) {
+    if (capacity > _capacity) {
+      _grow(capacity);
+    }
+  }
+
+  size_t capacity() const {
+    return _capacity;
+  }
+
+  friend bool operator==(const StableVector& lhs, const StableVector& rhs) {
+    return std::ranges::equal(lhs.span(), rhs.span());
+  }
+
+ protected:
+  static constexpr auto MIN_CAPACITY = size_t{16};
+
+  void _append(const std::span<const T> values) {
+    const auto size = _size.load(std::memory_order_relaxed);
+    if (size + values.size() > _capacity) {
+      _grow(size + values.size());
+    }
+    std::copy(values.begin(), values.end(), data() + size);
+    _size.store(size + values.size(), std::memory_order_release);
+  }
+
+  // Copies the elements into a new buffer that holds at least min_capacity elements and publishes it. The previous
+  // buffer is kept for readers that still use it.
+  void _grow(const size_t min_capacity) {
+    const auto capacity = std::max({min_capacity, 2 * _capacity, MIN_CAPACITY});
+    auto buffer = std::make_unique_for_overwrite<T[]>(capacity);
+    const auto* const data = _data.load(std::memory_order_relaxed);
+    std::copy(data, data + _size.load(std::memory_order_relaxed), buffer.get());
+    _data.store(buffer.get(), std::memory_order_release);
+    _buffers.emplace_back(std::move(buffer));
+    _capacity = capacity;
+  }
+
+  std::vector<std::unique_ptr<T[]>> _buffers;
+  std::atomic<T*> _data{nullptr};
+  std::atomic<size_t> _size{0};
+  size_t _capacity{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#include "string_dictionary.hpp"
+
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void StringDictionary::emplace_back(const std::string_view value) {
+  Assert(_characters.size() + value.size() <= std::numeric_limits<uint32_t>::max(),
+         "StringDictionary cannot hold more than 4 GB of characters.");
+  _characters.insert(_characters.end(), value.begin(), value.end());
+  _offsets.emplace_back(static_cast<uint32_t>(_characters.size()));
+}
+
+void StringDictionary::reserve(const size_t string_count, const size_t character_count) {
+  _offsets.reserve(string_count + 1);
+  _characters.reserve(character_count);
+}
+
+std::string_view StringDictionary::operator[](const size_t index) const {
+  DebugAssert(index < size(), "Tried to access StringDictionary out of bounds.");
+  const auto begin = _offsets[index];
+  return std::string_view{_characters.data() + begin, _offsets[index + 1] - begin};
+}
+
+size_t StringDictionary::size() const {
+  return _offsets.size() - 1;
+}
+
+bool StringDictionary::empty() const {
+  return size() == 0;
+}
+
+StringDictionary::Iterator StringDictionary::begin() const {
+  return Iterator{this, 0};
+}
+
+StringDictionary::Iterator StringDictionary::end() const {
+  return Iterator{this, static_cast<Iterator::difference_type>(size())};
+}
+
+size_t StringDictionary::estimate_memory_usage() const {
+  return _characters.size() + _offsets.size() * sizeof(uint32_t);
+}
+
+}  // namespace opossum
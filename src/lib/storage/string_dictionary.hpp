@@ -0,0 +1,127 @@
+#pragma once
+
+#include <compare>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+// StringDictionary stores the strings of a (Unsorted)DictionarySegment<std::string> in one contiguous character buffer
+// plus the offset of each string. Compared to std::vector<std::string>, it needs no allocation per string and binary
+// searches only touch the offsets and the characters themselves instead of chasing pointers to the heap. Strings are
+// accessed as std::string_views into the buffer.
+class StringDictionary {
+ public:
+  // Random access iterator over the strings of the dictionary, e.g., for std::lower_bound.
+  class Iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string_view;
+
+    Iterator() = default;
+    Iterator(const StringDictionary* dictionary, const difference_type index)
+        : _dictionary{dictionary}, _index{index} {}
+
+    reference operator*() const {
+      return (*_dictionary)[_index];
+    }
+
+    reference operator[](const difference_type offset) const {
+      return (*_dictionary)[_index + offset];
+    }
+
+    Iterator& operator++() {
+      ++_index;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++_index;
+      return copy;
+    }
+
+    Iterator& operator--() {
+      --_index;
+      return *this;
+    }
+
+    Iterator operator--(int) {
+      auto copy = *this;
+      --_index;
+      return copy;
+    }
+
+    Iterator& operator+=(const difference_type offset) {
+      _index += offset;
+      return *this;
+    }
+
+    Iterator& operator-=(const difference_type offset) {
+      _index -= offset;
+      return *this;
+    }
+
+    friend Iterator operator+(Iterator iterator, const difference_type offset) {
+      return iterator += offset;
+    }
+
+    friend Iterator operator+(const difference_type offset, Iterator iterator) {
+      return iterator += offset;
+    }
+
+    friend Iterator operator-(Iterator iterator, const difference_type offset) {
+      return iterator -= offset;
+    }
+
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) {
+      return lhs._index - rhs._index;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) {
+      return lhs._index == rhs._index;
+    }
+
+    friend std::strong_ordering operator<=>(const Iterator& lhs, const Iterator& rhs) {
+      return lhs._index <=> rhs._index;
+    }
+
+   private:
+    const StringDictionary* _dictionary{nullptr};
+    difference_type _index{0};
+  };
+
+  StringDictionary() = default;
+
+  // Appends a string. The order of the strings is kept, i.e., DictionarySegments have to append them in sorted order.
+  void emplace_back(const std::string_view value);
+
+  // Reserves space for the given number of strings with the given total number of characters.
+  void reserve(const size_t string_count, const size_t character_count);
+
+  // Returns the string at the given position.
+  std::string_view operator[](const size_t index) const;
+
+  // Returns the number of strings.
+  size_t size() const;
+
+  bool empty() const;
+
+  Iterator begin() const;
+  Iterator end() const;
+
+  // Returns the calculated memory usage, i.e., the size of the character buffer and the offsets.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::vector<char> _characters;
+  // The string i is stored in _characters[_offsets[i], _offsets[i + 1]).
+  std::vector<uint32_t> _offsets{0};
+};
+
+}  // namespace opossum
@@ -1,15 +1,29 @@
+#include <algorithm>
 #include <atomic>
+#include <exception>
 #include <thread>
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "bit_packed_integer_vector.hpp"
+#include "bloom_filter.hpp"
+#include "column_batch.hpp"
 #include "dictionary_segment.hpp"
+#include "encoding_advisor.hpp"
+#include "mvcc_data.hpp"
+#include "partitioning.hpp"
 #include "resolve_type.hpp"
+#include "segment_encoding_utils.hpp"
 #include "table.hpp"
+#include "unsorted_dictionary_segment.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
-Table::Table(const ChunkOffset init_target_chunk_size) : _target_chunk_size{init_target_chunk_size}, _row_count{0} {
+Table::Table(const ChunkOffset init_target_chunk_size)
+    : _partition_last_chunk_ids(1, INVALID_CHUNK_ID), _target_chunk_size{init_target_chunk_size}, _row_count{0} {
   create_new_chunk();
 }
 
@@ -17,46 +31,257 @@ Table::Table(const Table& reference_table, std::shared_ptr<Chunk> single_chunk)
     : _column_names(reference_table._column_names),
       _column_types(reference_table._column_types),
       _is_column_nullable(reference_table._is_column_nullable),
+      _uses_global_dictionary(reference_table.column_count()),
+      _uses_bloom_filter(reference_table.column_count(), false),
       _target_chunk_size(std::numeric_limits<ChunkOffset>::max() - 1),
       _row_count(single_chunk->size()) {
-  _chunks.emplace_back(std::move(single_chunk));
-  _is_chunk_mutable.emplace_back(false);
+  _chunks.append(std::move(single_chunk), false, PartitionID{0});
+  _partition_last_chunk_ids.emplace_back(ChunkID{0});
 }
 
 void Table::add_column_definition(const std::string& name, const std::string& type, const bool nullable) {
   _column_names.emplace_back(name);
   _column_types.emplace_back(type);
   _is_column_nullable.emplace_back(nullable);
+  _uses_global_dictionary.emplace_back(false);
+  _uses_bloom_filter.emplace_back(false);
 }
 
-static void add_value_segment(Chunk& chunk, const std::string& type, const bool nullable) {
+// Adds an empty segment that rows can be appended to, i.e., a ValueSegment or, for tables with a delta store, an
+// UnsortedDictionarySegment, together with its zone map.
+static void add_mutable_segment(Chunk& chunk, const std::string& type, const bool nullable, const bool is_delta,
+                                const ChunkOffset zone_map_block_size) {
   resolve_data_type(type, [&](const auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
-    const auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(nullable);
-    chunk.add_segment(std::move(value_segment));
+    const auto zone_map = std::make_shared<ZoneMap<ColumnDataType>>(zone_map_block_size);
+    if (is_delta) {
+      chunk.add_segment(std::make_shared<UnsortedDictionarySegment<ColumnDataType>>(nullable), zone_map);
+    } else {
+      chunk.add_segment(std::make_shared<ValueSegment<ColumnDataType>>(nullable), zone_map);
+    }
   });
 }
 
+// Builds a Bloom filter that contains the distinct values of the segment.
+static std::shared_ptr<BloomFilter> build_bloom_filter(const std::string& type,
+                                                       const std::shared_ptr<AbstractSegment>& segment) {
+  auto bloom_filter = std::shared_ptr<BloomFilter>{};
+  resolve_data_type(type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    // Strings are hashed as std::string_views, which hash like the std::strings that are looked up.
+    using HashedType =
+        std::conditional_t<std::is_same_v<ColumnDataType, std::string>, std::string_view, ColumnDataType>;
+    const auto insert_all = [&](const auto& values) {
+      bloom_filter = std::make_shared<BloomFilter>(values.size());
+      for (const auto& value : values) {
+        bloom_filter->insert(HashedType{value});
+      }
+    };
+
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<ColumnDataType>>(segment)) {
+      insert_all(dictionary_segment->dictionary());
+    } else if (const auto unsorted_segment =
+                   std::dynamic_pointer_cast<UnsortedDictionarySegment<ColumnDataType>>(segment)) {
+      insert_all(unsorted_segment->dictionary());
+    } else {
+      // The filter is sized for the worst case that all values are distinct.
+      const auto segment_size = segment->size();
+      bloom_filter = std::make_shared<BloomFilter>(segment_size);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+        const auto value = (*segment)[chunk_offset];
+        if (!variant_is_null(value)) {
+          bloom_filter->insert(type_cast<ColumnDataType>(value));
+        }
+      }
+    }
+  });
+  return bloom_filter;
+}
+
+// Returns the order of the values at [0, size) or std::nullopt if they are not sorted. Constant values count as
+// ascending, segments without NULL values as having them last.
+template <typename IsNull, typename GetValue>
+static std::optional<SortMode> detect_sort_mode(const ChunkOffset size, const IsNull& is_null,
+                                                const GetValue& get_value) {
+  auto non_null_begin = ChunkOffset{0};
+  while (non_null_begin < size && is_null(non_null_begin)) {
+    ++non_null_begin;
+  }
+  auto non_null_end = size;
+  while (non_null_end > non_null_begin && is_null(non_null_end - 1)) {
+    --non_null_end;
+  }
+  const auto nulls_first = non_null_begin > 0;
+  if (nulls_first && non_null_end < size) {
+    return std::nullopt;
+  }
+
+  auto is_ascending = true;
+  auto is_descending = true;
+  for (auto chunk_offset = non_null_begin + 1; chunk_offset < non_null_end; ++chunk_offset) {
+    if (is_null(chunk_offset)) {
+      return std::nullopt;
+    }
+    const auto& previous_value = get_value(chunk_offset - 1);
+    const auto& value = get_value(chunk_offset);
+    is_ascending &= !(value < previous_value);
+    is_descending &= !(previous_value < value);
+    if (!is_ascending && !is_descending) {
+      return std::nullopt;
+    }
+  }
+
+  if (is_ascending) {
+    return nulls_first ? SortMode::AscendingNullsFirst : SortMode::AscendingNullsLast;
+  }
+  return nulls_first ? SortMode::DescendingNullsFirst : SortMode::DescendingNullsLast;
+}
+
+// Detects whether the values of a ValueSegment or an UnsortedDictionarySegment are sorted. Returns std::nullopt for
+// unsorted and other segments.
+static std::optional<SortMode> detect_sort_mode(const std::string& type,
+                                                const std::shared_ptr<AbstractSegment>& segment) {
+  auto sort_mode = std::optional<SortMode>{};
+  resolve_data_type(type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment)) {
+      const auto& values = value_segment->values();
+      const auto is_null = [&](const ChunkOffset chunk_offset) { return value_segment->is_null(chunk_offset); };
+      const auto get_value = [&](const ChunkOffset chunk_offset) -> const auto& { return values[chunk_offset]; };
+      sort_mode = detect_sort_mode(value_segment->size(), is_null, get_value);
+    } else if (const auto unsorted_segment =
+                   std::dynamic_pointer_cast<UnsortedDictionarySegment<ColumnDataType>>(segment)) {
+      const auto& value_ids = unsorted_segment->value_ids();
+      const auto& dictionary = unsorted_segment->dictionary();
+      const auto null_value_id = unsorted_segment->null_value_id();
+      const auto is_null = [&](const ChunkOffset chunk_offset) { return value_ids[chunk_offset] == null_value_id; };
+      const auto get_value = [&](const ChunkOffset chunk_offset) { return dictionary[value_ids[chunk_offset]]; };
+      sort_mode = detect_sort_mode(unsorted_segment->size(), is_null, get_value);
+    }
+  });
+  return sort_mode;
+}
+
 void Table::add_column(const std::string& name, const std::string& type, const bool nullable) {
   Assert(row_count() == 0, "Tried to create column on non-empty table.");
   add_column_definition(name, type, nullable);
-  add_value_segment(*last_chunk(), type, nullable);
+  add_mutable_segment(*last_chunk(), type, nullable, _uses_delta_store, _zone_map_block_size);
 }
 
 void Table::create_new_chunk() {
-  _is_chunk_mutable.emplace_back(true);
-  _chunks.emplace_back(std::make_shared<Chunk>());
-  for (auto column_index = ColumnID{0}; column_index < column_count(); ++column_index) {
-    add_value_segment(*last_chunk(), _column_types[column_index], _is_column_nullable[column_index]);
+  const auto lock = std::lock_guard{_chunk_mutex};
+  _create_new_chunk();
+}
+
+void Table::_create_new_chunk(const PartitionID partition_id) {
+  // The chunk is published only after its segments were added, so that readers never see it incomplete.
+  _partition_last_chunk_ids[partition_id] =
+      _chunks.append(_create_mutable_chunk(_uses_delta_store), true, partition_id);
+}
+
+std::shared_ptr<Chunk> Table::_create_mutable_chunk(const bool is_delta) const {
+  auto chunk = std::make_shared<Chunk>();
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    add_mutable_segment(*chunk, _column_types[column_id], _is_column_nullable[column_id], is_delta,
+                        _zone_map_block_size);
   }
+  chunk->set_mvcc_data(std::make_shared<MvccData>());
+  return chunk;
 }
 
-void Table::append(const std::vector<AllTypeVariant>& values) {
-  if (!_is_chunk_mutable.back() || last_chunk()->size() == target_chunk_size()) {
-    create_new_chunk();
+std::shared_ptr<Chunk> Table::_append(const std::vector<AllTypeVariant>& values) {
+  const auto partition_id =
+      _partitioning ? _partitioning->partition(values.at(_partitioning->column_id())) : PartitionID{0};
+
+  const auto chunk_id = _partition_last_chunk_ids[partition_id];
+  if (chunk_id == INVALID_CHUNK_ID || !_chunks.is_mutable(chunk_id) ||
+      get_chunk(chunk_id)->size() >= target_chunk_size()) {
+    _create_new_chunk(partition_id);
   }
-  last_chunk()->append(values);
+  const auto chunk = get_chunk(_partition_last_chunk_ids[partition_id]);
+  chunk->append(values);
   ++_row_count;
+  return chunk;
+}
+
+void Table::append(const std::vector<AllTypeVariant>& values) {
+  const auto lock = std::lock_guard{_chunk_mutex};
+  const auto chunk = _append(values);
+  const auto chunk_offset = static_cast<ChunkOffset>(chunk->size() - 1);
+  TransactionManager::get().commit(
+      [&](const CommitID commit_id) { chunk->mvcc_data()->set_begin_commit_id(chunk_offset, commit_id); });
+}
+
+void Table::append(const std::vector<AllTypeVariant>& values, TransactionContext& transaction_context) {
+  Assert(transaction_context.phase() == TransactionPhase::Active, "Tried to insert into a finished transaction.");
+  const auto lock = std::lock_guard{_chunk_mutex};
+  const auto chunk = _append(values);
+  const auto chunk_offset = static_cast<ChunkOffset>(chunk->size() - 1);
+  chunk->mvcc_data()->set_transaction_id(chunk_offset, transaction_context.transaction_id());
+  transaction_context.register_insert(chunk->mvcc_data(), chunk_offset);
+}
+
+void Table::append_columns(const std::vector<std::shared_ptr<const AbstractColumnBatch>>& column_batches) {
+  Assert(column_batches.size() == column_count(), "Tried to append columns with unfitting number of columns.");
+  const auto row_count = column_batches.empty() ? size_t{0} : column_batches.front()->size();
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    const auto& column_batch = *column_batches[column_id];
+    Assert(column_batch.size() == row_count, "All column batches have to have the same number of rows.");
+    resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto* const typed_column_batch = dynamic_cast<const ColumnBatch<ColumnDataType>*>(&column_batch);
+      Assert(typed_column_batch, "Column batch does not match the column's data type.");
+      Assert(_is_column_nullable[column_id] || !typed_column_batch->null_values() ||
+                 typed_column_batch->null_values()->count() == 0,
+             "Tried to append NULL values to a non-nullable column.");
+    });
+  }
+
+  // The partitions are the only values that have to be looked at row by row.
+  auto partition_ids = std::vector<PartitionID>{};
+  if (_partitioning) {
+    const auto& partitioning_column_batch = *column_batches[_partitioning->column_id()];
+    partition_ids.reserve(row_count);
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      partition_ids.emplace_back(_partitioning->partition(partitioning_column_batch[row_index]));
+    }
+  }
+
+  const auto lock = std::lock_guard{_chunk_mutex};
+  auto appended_ranges = std::vector<std::tuple<std::shared_ptr<MvccData>, ChunkOffset, ChunkOffset>>{};
+  auto begin = size_t{0};
+  while (begin < row_count) {
+    const auto partition_id = _partitioning ? partition_ids[begin] : PartitionID{0};
+    const auto chunk_id = _partition_last_chunk_ids[partition_id];
+    if (chunk_id == INVALID_CHUNK_ID || !_chunks.is_mutable(chunk_id) ||
+        get_chunk(chunk_id)->size() >= target_chunk_size()) {
+      _create_new_chunk(partition_id);
+    }
+    const auto chunk = get_chunk(_partition_last_chunk_ids[partition_id]);
+
+    // Append the rows up to the end of the chunk or of the run of rows in the same partition.
+    auto end = std::min(row_count, begin + (target_chunk_size() - chunk->size()));
+    if (_partitioning) {
+      end = static_cast<size_t>(std::find_if(partition_ids.begin() + begin + 1, partition_ids.begin() + end,
+                                             [&](const auto row_partition_id) {
+                                               return row_partition_id != partition_id;
+                                             }) -
+                                partition_ids.begin());
+    }
+    const auto chunk_begin = chunk->size();
+    chunk->append_columns(column_batches, begin, end);
+    appended_ranges.emplace_back(chunk->mvcc_data(), chunk_begin, chunk->size());
+    _row_count += end - begin;
+    begin = end;
+  }
+
+  TransactionManager::get().commit([&](const CommitID commit_id) {
+    for (const auto& [mvcc_data, range_begin, range_end] : appended_ranges) {
+      for (auto chunk_offset = range_begin; chunk_offset < range_end; ++chunk_offset) {
+        mvcc_data->set_begin_commit_id(chunk_offset, commit_id);
+      }
+    }
+  });
 }
 
 ColumnCount Table::column_count() const {
@@ -67,8 +292,19 @@ uint64_t Table::row_count() const {
   return _row_count;
 }
 
+uint64_t Table::approx_valid_row_count() const {
+  auto invalidated_row_count = uint64_t{0};
+  for (auto chunk_id = ChunkID{0}, chunk_count = this->chunk_count(); chunk_id < chunk_count; ++chunk_id) {
+    if (const auto mvcc_data = get_chunk(chunk_id)->mvcc_data()) {
+      invalidated_row_count += mvcc_data->invalidated_row_count();
+    }
+  }
+  const auto row_count = this->row_count();
+  return row_count > invalidated_row_count ? row_count - invalidated_row_count : 0;
+}
+
 ChunkID Table::chunk_count() const {
-  return static_cast<ChunkID>(_chunks.size());
+  return _chunks.size();
 }
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
@@ -98,44 +334,818 @@ bool Table::column_nullable(const ColumnID column_id) const {
 }
 
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
-  return std::atomic_load(&_chunks.at(chunk_id));
+  return _chunks.get(chunk_id);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
-  return std::atomic_load(&_chunks.at(chunk_id));
+  return _chunks.get(chunk_id);
+}
+
+std::shared_ptr<const void> Table::pin_chunk_ids() const {
+  _chunk_id_pin_count->fetch_add(1);
+  return std::shared_ptr<const void>(_chunk_id_pin_count.get(),
+                                     [pin_count = _chunk_id_pin_count](const void*) { pin_count->fetch_sub(1); });
+}
+
+bool Table::is_chunk_mutable(const ChunkID chunk_id) const {
+  return _chunks.is_mutable(chunk_id);
 }
 
 std::shared_ptr<Chunk> Table::last_chunk() {
   return get_chunk(static_cast<ChunkID>(chunk_count() - 1));
 }
 
-void Table::compress_chunk(const ChunkID chunk_id) {
-  const auto chunk = get_chunk(chunk_id);
+void Table::compress_chunk(const ChunkID chunk_id, const SegmentEncodingSpec& encoding_spec) {
+  compress_chunk(chunk_id, std::vector<SegmentEncodingSpec>(column_count(), encoding_spec));
+}
+
+void Table::compress_chunk(const ChunkID chunk_id, const std::vector<SegmentEncodingSpec>& column_encoding_specs) {
+  _encode_chunk(chunk_id, get_chunk(chunk_id), column_encoding_specs,
+                [&](const std::shared_ptr<Chunk>& compressed_chunk) {
+                  _chunks.replace(chunk_id, compressed_chunk);
+                  _chunks.set_immutable(chunk_id);
+                });
+}
+
+void Table::_encode_chunk(const ChunkID chunk_id, const std::shared_ptr<const Chunk>& chunk,
+                          const std::vector<SegmentEncodingSpec>& column_encoding_specs,
+                          const std::function<void(const std::shared_ptr<Chunk>&)>& publish) {
   const auto column_count = chunk->column_count();
+  Assert(column_encoding_specs.size() == column_count, "Need exactly one encoding spec per column.");
 
-  auto dictionary_segments = std::vector<std::shared_ptr<AbstractSegment>>(column_count);
+  auto encoded_segments = std::vector<std::shared_ptr<AbstractSegment>>(column_count);
+  auto bloom_filters = std::vector<std::shared_ptr<const BloomFilter>>(column_count);
+  auto sort_modes = std::vector<std::optional<SortMode>>(column_count);
+  auto exceptions = std::vector<std::exception_ptr>(column_count);
   auto thread_handles = std::vector<std::thread>();
   thread_handles.reserve(column_count);
 
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-    thread_handles.emplace_back([this, column_id, &chunk, &dictionary_segments]() {
-      const auto segment = chunk->get_segment(column_id);
-      resolve_data_type(column_type(column_id), [&](auto type) {
-        using DataType = typename decltype(type)::type;
-        dictionary_segments[column_id] = std::make_shared<DictionarySegment<DataType>>(segment);
-      });
+    Assert(!_uses_global_dictionary[column_id] ||
+               column_encoding_specs[column_id].encoding_type == EncodingType::Dictionary,
+           "Columns with a global dictionary can only be dictionary-encoded.");
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    thread_handles.emplace_back([&, column_id]() {
+      // Exceptions must not escape the thread (which would terminate the program), so we rethrow them after joining.
+      try {
+        // The Bloom filter is built from the segment before encoding, unless the chunk already has one.
+        const auto segment = chunk->get_segment(column_id);
+        bloom_filters[column_id] = chunk->get_bloom_filter(column_id);
+        if (_uses_bloom_filter[column_id] && !bloom_filters[column_id]) {
+          bloom_filters[column_id] = build_bloom_filter(column_type(column_id), segment);
+        }
+        sort_modes[column_id] = chunk->sort_mode(column_id);
+        if (!sort_modes[column_id]) {
+          sort_modes[column_id] = detect_sort_mode(column_type(column_id), segment);
+        }
+
+        // Encoding with the global dictionary might re-encode other chunks and is thus done sequentially below.
+        if (!_uses_global_dictionary[column_id]) {
+          encoded_segments[column_id] =
+              encode_segment(column_type(column_id), segment, column_encoding_specs[column_id]);
+        }
+      } catch (...) {
+        exceptions[column_id] = std::current_exception();
+      }
     });
   }
 
+  for (auto& thread_handle : thread_handles) {
+    thread_handle.join();
+  }
+
+  // Encoding with the global dictionary reads and replaces other chunks, which must not interfere with appends. The
+  // encoded chunk is published under the same lock. Otherwise, another chunk could rebuild the dictionary without the
+  // values of this chunk in the meantime. Columns that started to use a global dictionary while the threads encoded
+  // the segments are encoded with it as well.
+  const auto lock = std::lock_guard{_chunk_mutex};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (_uses_global_dictionary[column_id] && !exceptions[column_id]) {
+      encoded_segments[column_id] =
+          _encode_with_global_dictionary(column_id, chunk_id, chunk->get_segment(column_id),
+                                         column_encoding_specs[column_id].vector_compression_type);
+    }
+  }
+
   auto compressed_chunk = std::make_shared<Chunk>();
+  compressed_chunk->set_mvcc_data(chunk->mvcc_data());
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (exceptions[column_id]) {
+      std::rethrow_exception(exceptions[column_id]);
+    }
+    Assert(encoded_segments[column_id], "Compression thread terminated without writing their encoded segment.");
+    // The encoded segment holds the same values, so that the zone map remains valid.
+    compressed_chunk->add_segment(encoded_segments[column_id], chunk->get_zone_map(column_id),
+                                  bloom_filters[column_id]);
+    if (sort_modes[column_id]) {
+      compressed_chunk->set_sort_mode(column_id, *sort_modes[column_id]);
+    }
+  }
+  publish(compressed_chunk);
+}
+
+std::vector<SegmentEncodingReport> Table::compress_chunk(const ChunkID chunk_id,
+                                                         const EncodingAdvisor& encoding_advisor) {
+  const auto chunk = get_chunk(chunk_id);
+  const auto column_count = chunk->column_count();
+
+  auto reports = std::vector<SegmentEncodingReport>{};
+  reports.reserve(column_count);
+  auto column_encoding_specs = std::vector<SegmentEncodingSpec>{};
+  column_encoding_specs.reserve(column_count);
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-    thread_handles[column_id].join();
-    Assert(dictionary_segments[column_id], "Compression thread terminated without writing their dictionary segment.");
-    compressed_chunk->add_segment(dictionary_segments[column_id]);
+    if (_uses_global_dictionary[column_id]) {
+      // Columns with a global dictionary are always dictionary-encoded. Their memory usage is not estimated.
+      column_encoding_specs.emplace_back();
+      reports.push_back({column_id, SegmentEncodingSpec{}, 0, 0});
+      continue;
+    }
+    const auto recommendation = encoding_advisor.recommend(column_type(column_id), chunk->get_segment(column_id));
+    column_encoding_specs.emplace_back(recommendation.encoding_spec);
+    reports.push_back({column_id, recommendation.encoding_spec, recommendation.expected_memory_usage, 0});
+  }
+
+  compress_chunk(chunk_id, column_encoding_specs);
+
+  const auto compressed_chunk = get_chunk(chunk_id);
+  for (auto& report : reports) {
+    report.actual_memory_usage = compressed_chunk->get_segment(report.column_id)->estimate_memory_usage();
+  }
+  return reports;
+}
+
+void Table::use_global_dictionary(const ColumnID column_id) {
+  Assert(column_id < column_count(), "Tried to use global dictionary for a non-existent column.");
+  const auto lock = std::lock_guard{_chunk_mutex};
+  // The flag is only set once the segments were re-encoded, which fails if they are neither ValueSegments nor
+  // DictionarySegments.
+  _encode_with_global_dictionary(column_id, INVALID_CHUNK_ID, nullptr, VectorCompressionType::FixedWidthInteger);
+  _uses_global_dictionary[column_id] = true;
+}
+
+bool Table::uses_global_dictionary(const ColumnID column_id) const {
+  return _uses_global_dictionary.at(column_id);
+}
+
+std::shared_ptr<AbstractSegment> Table::_encode_with_global_dictionary(
+    const ColumnID column_id, const ChunkID chunk_id, const std::shared_ptr<AbstractSegment>& segment,
+    const VectorCompressionType vector_compression_type) {
+  auto encoded_segment = std::shared_ptr<AbstractSegment>{};
+  resolve_data_type(column_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    using Dictionary = typename DictionarySegment<ColumnDataType>::Dictionary;
+
+    auto other_chunk_ids = std::vector<ChunkID>{};
+    for (auto other_chunk_id = ChunkID{0}; other_chunk_id < chunk_count(); ++other_chunk_id) {
+      if (!_chunks.is_mutable(other_chunk_id) && other_chunk_id != chunk_id) {
+        other_chunk_ids.emplace_back(other_chunk_id);
+      }
+    }
+
+    // All immutable segments of the column share the same dictionary, so it suffices to find the first one.
+    auto dictionary = std::shared_ptr<const Dictionary>{};
+    for (const auto other_chunk_id : other_chunk_ids) {
+      const auto other_segment = get_chunk(other_chunk_id)->get_segment(column_id);
+      const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<ColumnDataType>>(other_segment);
+      if (dictionary_segment && dictionary_segment->has_shared_dictionary()) {
+        dictionary = dictionary_segment->shared_dictionary();
+        break;
+      }
+    }
+
+    if (segment && dictionary) {
+      const auto contains = [&](const auto& value) {
+        return std::binary_search(dictionary->begin(), dictionary->end(), value);
+      };
+      auto contains_all_values = true;
+      if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment)) {
+        const auto& values = value_segment->values();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size() && contains_all_values; ++chunk_offset) {
+          contains_all_values = value_segment->is_null(chunk_offset) || contains(values[chunk_offset]);
+        }
+      } else if (const auto dictionary_segment =
+                     std::dynamic_pointer_cast<DictionarySegment<ColumnDataType>>(segment)) {
+        contains_all_values = std::ranges::all_of(dictionary_segment->dictionary(), contains);
+      } else if (const auto unsorted_segment =
+                     std::dynamic_pointer_cast<UnsortedDictionarySegment<ColumnDataType>>(segment)) {
+        contains_all_values = std::ranges::all_of(unsorted_segment->dictionary(), contains);
+      }
+
+      if (contains_all_values) {
+        encoded_segment =
+            std::make_shared<DictionarySegment<ColumnDataType>>(segment, dictionary, vector_compression_type);
+        return;
+      }
+    }
+
+    // The dictionary does not exist yet or lacks values of the segment. Rebuild it and re-encode all segments that use
+    // it, keeping their vector compression.
+    auto segments = std::vector<std::shared_ptr<AbstractSegment>>{};
+    segments.reserve(other_chunk_ids.size() + 1);
+    for (const auto other_chunk_id : other_chunk_ids) {
+      segments.emplace_back(get_chunk(other_chunk_id)->get_segment(column_id));
+    }
+    if (segment) {
+      segments.emplace_back(segment);
+    }
+    if (segments.empty()) {
+      return;
+    }
+    dictionary = DictionarySegment<ColumnDataType>::build_shared_dictionary(segments);
+
+    for (auto index = size_t{0}; index < other_chunk_ids.size(); ++index) {
+      auto other_vector_compression_type = VectorCompressionType::FixedWidthInteger;
+      if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<ColumnDataType>>(segments[index]);
+          dictionary_segment &&
+          std::dynamic_pointer_cast<const BitPackedIntegerVector>(dictionary_segment->attribute_vector())) {
+        other_vector_compression_type = VectorCompressionType::BitPacking;
+      }
+      _replace_segment(other_chunk_ids[index], column_id,
+                       std::make_shared<DictionarySegment<ColumnDataType>>(segments[index], dictionary,
+                                                                           other_vector_compression_type),
+                       get_chunk(other_chunk_ids[index])->get_bloom_filter(column_id));
+    }
+    if (segment) {
+      encoded_segment =
+          std::make_shared<DictionarySegment<ColumnDataType>>(segment, dictionary, vector_compression_type);
+    }
+  });
+  return encoded_segment;
+}
+
+void Table::use_bloom_filter(const ColumnID column_id) {
+  Assert(column_id < column_count(), "Tried to use Bloom filter for a non-existent column.");
+  const auto lock = std::lock_guard{_chunk_mutex};
+  _uses_bloom_filter[column_id] = true;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (_chunks.is_mutable(chunk_id) || chunk->get_bloom_filter(column_id)) {
+      continue;
+    }
+    const auto segment = chunk->get_segment(column_id);
+    _replace_segment(chunk_id, column_id, segment, build_bloom_filter(column_type(column_id), segment));
+  }
+}
+
+bool Table::uses_bloom_filter(const ColumnID column_id) const {
+  return _uses_bloom_filter.at(column_id);
+}
+
+void Table::use_delta_store(const SegmentEncodingSpec& main_encoding_spec) {
+  Assert(row_count() == 0, "Tried to enable the delta store on non-empty table.");
+  const auto lock = std::lock_guard{_chunk_mutex};
+  _uses_delta_store = true;
+  _main_encoding_spec = main_encoding_spec;
+
+  // Replace the segments of the (empty) last chunk.
+  _chunks.replace(static_cast<ChunkID>(chunk_count() - 1), _create_mutable_chunk(true));
+}
+
+bool Table::uses_delta_store() const {
+  return _uses_delta_store;
+}
+
+std::vector<ChunkID> Table::merge_delta() {
+  Assert(_uses_delta_store, "Tried to merge the delta of a table without delta store.");
+
+  auto delta_chunks = std::vector<std::pair<ChunkID, std::shared_ptr<const Chunk>>>{};
+  {
+    const auto lock = std::lock_guard{_chunk_mutex};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+      const auto chunk = get_chunk(chunk_id);
+      if (_chunks.is_mutable(chunk_id) && chunk->size() >= _target_chunk_size) {
+        delta_chunks.emplace_back(chunk_id, chunk);
+      }
+    }
+  }
+
+  // Full chunks are not appended to anymore, so they are encoded without holding the lock. Each merged chunk is
+  // swapped in atomically. Readers thus see either the delta chunk or the main chunk, which contain the same rows.
+  const auto column_encoding_specs = _main_encoding_specs();
+
+  auto merged_chunk_ids = std::vector<ChunkID>{};
+  merged_chunk_ids.reserve(delta_chunks.size());
+  for (const auto& [chunk_id, chunk] : delta_chunks) {
+    _encode_chunk(chunk_id, chunk, column_encoding_specs, [&](const std::shared_ptr<Chunk>& main_chunk) {
+      _chunks.replace(chunk_id, main_chunk);
+      _chunks.set_immutable(chunk_id);
+    });
+    merged_chunk_ids.emplace_back(chunk_id);
   }
+  return merged_chunk_ids;
+}
 
-  std::atomic_store(&_chunks.at(chunk_id), compressed_chunk);
-  _is_chunk_mutable.at(chunk_id) = false;
+std::vector<SegmentEncodingSpec> Table::_main_encoding_specs() const {
+  auto column_encoding_specs = std::vector<SegmentEncodingSpec>(column_count(), _main_encoding_spec);
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    if (_uses_global_dictionary[column_id]) {
+      column_encoding_specs[column_id].encoding_type = EncodingType::Dictionary;
+    }
+  }
+  return column_encoding_specs;
+}
+
+void Table::_publish_sealed_chunk(const std::shared_ptr<Chunk>& chunk, const PartitionID partition_id) {
+  const auto publish = [&](const std::shared_ptr<Chunk>& sealed_chunk) {
+    auto& mvcc_data = *sealed_chunk->mvcc_data();
+    TransactionManager::get().commit([&](const CommitID commit_id) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < mvcc_data.size(); ++chunk_offset) {
+        mvcc_data.set_begin_commit_id(chunk_offset, commit_id);
+      }
+    });
+    _add_immutable_chunk(sealed_chunk, partition_id);
+    _row_count += sealed_chunk->size();
+  };
+
+  // Chunks of tables with a delta store are merged into the main right away, which is thus done by the writer's thread.
+  if (_uses_delta_store) {
+    _encode_chunk(INVALID_CHUNK_ID, chunk, _main_encoding_specs(), publish);
+    return;
+  }
+  const auto lock = std::lock_guard{_chunk_mutex};
+  publish(chunk);
+}
+
+void Table::_add_immutable_chunk(const std::shared_ptr<Chunk>& chunk, const PartitionID partition_id) {
+  // Positions collected before the chunk was reclaimed must not point into the new chunk.
+  if (*_chunk_id_pin_count == 0) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+      if (!_chunks.is_mutable(chunk_id) && _chunks.partition_id(chunk_id) == partition_id &&
+          get_chunk(chunk_id)->size() == 0) {
+        _chunks.replace(chunk_id, chunk);
+        return;
+      }
+    }
+  }
+  _chunks.append(chunk, false, partition_id);
+}
+
+// Copies the values of a segment into a ValueSegment, so that they can be accessed by position without decoding.
+template <typename T>
+static std::shared_ptr<ValueSegment<T>> materialize_segment(const std::shared_ptr<AbstractSegment>& segment,
+                                                            const bool nullable) {
+  if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment)) {
+    return value_segment;
+  }
+  if (const auto unsorted_segment = std::dynamic_pointer_cast<UnsortedDictionarySegment<T>>(segment)) {
+    return unsorted_segment->materialize();
+  }
+
+  auto value_segment = std::make_shared<ValueSegment<T>>(nullable);
+  const auto segment_size = segment->size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    value_segment->append((*segment)[chunk_offset]);
+  }
+  return value_segment;
+}
+
+void Table::cluster(const std::vector<ColumnID>& clustering_column_ids, const SegmentEncodingSpec& encoding_spec) {
+  cluster(clustering_column_ids, std::vector<SegmentEncodingSpec>(column_count(), encoding_spec));
+}
+
+void Table::cluster(const std::vector<ColumnID>& clustering_column_ids,
+                    const std::vector<SegmentEncodingSpec>& column_encoding_specs) {
+  Assert(column_encoding_specs.size() == column_count(), "Need exactly one encoding spec per column.");
+  Assert(!clustering_column_ids.empty(), "Tried to cluster without clustering columns.");
+  for (const auto column_id : clustering_column_ids) {
+    Assert(column_id < column_count(), "Tried to cluster by a non-existent column.");
+  }
+  const auto row_count = this->row_count();
+  const auto chunk_count = this->chunk_count();
+  const auto column_count = this->column_count();
+  if (row_count == 0) {
+    return;
+  }
+
+  // Encoded segments are decoded once, so that sorting and copying the rows can access them by position.
+  auto segments = std::vector<std::vector<std::shared_ptr<AbstractSegment>>>(column_count);
+  auto positions = PosList{};
+  positions.reserve(row_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(column_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        segments[column_id].emplace_back(
+            materialize_segment<ColumnDataType>(chunk->get_segment(column_id), column_nullable(column_id)));
+      });
+    }
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      positions.push_back({chunk_id, chunk_offset});
+    }
+  }
+
+  // Stable sorts by each clustering column, starting with the least significant one, order the rows by all of them.
+  for (auto iterator = clustering_column_ids.rbegin(); iterator != clustering_column_ids.rend(); ++iterator) {
+    const auto& column_segments = segments[*iterator];
+    resolve_data_type(column_type(*iterator), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      std::ranges::stable_sort(positions, [&](const RowID& lhs, const RowID& rhs) {
+        const auto& lhs_segment = static_cast<const ValueSegment<ColumnDataType>&>(*column_segments[lhs.chunk_id]);
+        const auto& rhs_segment = static_cast<const ValueSegment<ColumnDataType>&>(*column_segments[rhs.chunk_id]);
+        const auto lhs_is_null = lhs_segment.is_null(lhs.chunk_offset);
+        const auto rhs_is_null = rhs_segment.is_null(rhs.chunk_offset);
+        if (lhs_is_null || rhs_is_null) {
+          return !lhs_is_null;
+        }
+        return lhs_segment.values()[lhs.chunk_offset] < rhs_segment.values()[rhs.chunk_offset];
+      });
+    });
+  }
+
+  // The clustered chunks are built in a table with the same columns and options, whose chunks are then taken over.
+  auto clustered_table = Table{_target_chunk_size};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    clustered_table.add_column(column_name(column_id), column_type(column_id), column_nullable(column_id));
+    if (_uses_bloom_filter[column_id]) {
+      clustered_table.use_bloom_filter(column_id);
+    }
+  }
+  if (_zone_map_block_size > 0) {
+    clustered_table.use_block_zone_maps(_zone_map_block_size);
+  }
+  if (_partitioning) {
+    clustered_table._set_partitioning(_partitioning);
+  }
+
+  auto mvcc_data = std::vector<std::shared_ptr<const MvccData>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    mvcc_data.emplace_back(get_chunk(chunk_id)->mvcc_data());
+  }
+  auto row = std::vector<AllTypeVariant>(column_count);
+  {
+    // The rows are not committed again, but take over the versioning information of the original rows.
+    const auto clustered_table_lock = std::lock_guard{clustered_table._chunk_mutex};
+    for (const auto& position : positions) {
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        row[column_id] = (*segments[column_id][position.chunk_id])[position.chunk_offset];
+      }
+      const auto clustered_chunk = clustered_table._append(row);
+      clustered_chunk->mvcc_data()->copy_row(static_cast<ChunkOffset>(clustered_chunk->size() - 1),
+                                             *mvcc_data[position.chunk_id], position.chunk_offset);
+    }
+  }
+
+  // Global dictionaries are built once for all chunks instead of growing with every compressed chunk.
+  auto encoding_specs = column_encoding_specs;
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (_uses_global_dictionary[column_id]) {
+      encoding_specs[column_id] = SegmentEncodingSpec{};
+    }
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < clustered_table.chunk_count(); ++chunk_id) {
+    // The first chunk of a partitioned table stays empty if no row belongs to the first partition.
+    if (clustered_table.get_chunk(chunk_id)->size() > 0) {
+      clustered_table.compress_chunk(chunk_id, encoding_specs);
+    }
+  }
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (_uses_global_dictionary[column_id]) {
+      clustered_table.use_global_dictionary(column_id);
+    }
+  }
+
+  const auto lock = std::lock_guard{_chunk_mutex};
+  Assert(_row_count == row_count && this->chunk_count() == chunk_count, "Table was modified while being clustered.");
+  _chunks.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < clustered_table.chunk_count(); ++chunk_id) {
+    _chunks.append(clustered_table.get_chunk(chunk_id), clustered_table._chunks.is_mutable(chunk_id),
+                   clustered_table.partition_id(chunk_id));
+  }
+  _partition_last_chunk_ids = std::move(clustered_table._partition_last_chunk_ids);
+}
+
+void Table::rebalance_chunks(const ChunkOffset min_chunk_size, const ChunkOffset max_chunk_size,
+                             const SegmentEncodingSpec& encoding_spec) {
+  rebalance_chunks(min_chunk_size, max_chunk_size, std::vector<SegmentEncodingSpec>(column_count(), encoding_spec));
+}
+
+void Table::rebalance_chunks(const ChunkOffset min_chunk_size, const ChunkOffset max_chunk_size,
+                             const std::vector<SegmentEncodingSpec>& column_encoding_specs) {
+  Assert(column_encoding_specs.size() == column_count(), "Need exactly one encoding spec per column.");
+  Assert(max_chunk_size > 0, "Maximum chunk size must be positive.");
+  // Otherwise, splitting a chunk that is slightly too large would create chunks that are too small.
+  Assert(min_chunk_size <= max_chunk_size / 2, "Minimum chunk size must not exceed half the maximum chunk size.");
+
+  // Invalidated rows are not rewritten and thus do not count towards the size of a chunk.
+  auto valid_row_counts = std::vector<uint64_t>{};
+  auto is_chunk_mutable = std::vector<bool>{};
+  auto chunk_partition_ids = std::vector<PartitionID>{};
+  {
+    const auto lock = std::lock_guard{_chunk_mutex};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+      const auto chunk = get_chunk(chunk_id);
+      const auto mvcc_data = chunk->mvcc_data();
+      valid_row_counts.emplace_back(chunk->size() - (mvcc_data ? mvcc_data->invalidated_row_count() : 0));
+      // Chunks without versioning information cannot be rewritten by a transaction.
+      is_chunk_mutable.emplace_back(_chunks.is_mutable(chunk_id) || !mvcc_data);
+      chunk_partition_ids.emplace_back(_chunks.partition_id(chunk_id));
+    }
+  }
+  const auto chunk_count = static_cast<ChunkID>(valid_row_counts.size());
+  const auto is_too_small = [&](const ChunkID chunk_id) { return valid_row_counts[chunk_id] < min_chunk_size; };
+  const auto is_out_of_band = [&](const ChunkID chunk_id) {
+    return is_too_small(chunk_id) || valid_row_counts[chunk_id] > max_chunk_size;
+  };
+
+  // Groups of consecutive immutable chunks of a partition that are rewritten together. Mutable chunks are still being
+  // appended to and separate the groups. Chunks without valid rows are skipped, as compact_chunks reclaims them.
+  auto groups = std::vector<std::vector<ChunkID>>{};
+  for (auto partition_id = PartitionID{0}; partition_id < partition_count(); ++partition_id) {
+    auto run = std::vector<ChunkID>{};
+    const auto add_groups = [&]() {
+      auto previous_group_end = size_t{0};
+      for (auto begin = size_t{0}; begin < run.size();) {
+        if (!is_out_of_band(run[begin])) {
+          ++begin;
+          continue;
+        }
+        auto end = begin;
+        while (end < run.size() && is_out_of_band(run[end])) {
+          ++end;
+        }
+        auto group_begin = begin;
+        if (end - begin == 1 && is_too_small(run[begin])) {
+          if (begin > previous_group_end) {
+            --group_begin;
+          } else if (end < run.size()) {
+            ++end;
+          } else {
+            // A single chunk that is too small cannot be fixed without neighbours.
+            begin = end;
+            continue;
+          }
+        }
+        groups.emplace_back(run.begin() + group_begin, run.begin() + end);
+        previous_group_end = end;
+        begin = end;
+      }
+      run.clear();
+    };
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (chunk_partition_ids[chunk_id] != partition_id) {
+        continue;
+      }
+      if (is_chunk_mutable[chunk_id]) {
+        add_groups();
+      } else if (valid_row_counts[chunk_id] > 0) {
+        run.emplace_back(chunk_id);
+      }
+    }
+    add_groups();
+  }
+
+  // Groups with rows that are held by running transactions are skipped. The old chunks are reclaimed right away if no
+  // running transaction can see them anymore.
+  for (const auto& group : groups) {
+    if (!_rewrite_chunks(group, max_chunk_size, column_encoding_specs)) {
+      continue;
+    }
+    for (const auto chunk_id : group) {
+      _try_to_reclaim_chunk(chunk_id);
+    }
+  }
+}
+
+std::vector<ChunkID> Table::compact_chunks(const double invalidated_fraction_threshold,
+                                           const SegmentEncodingSpec& encoding_spec) {
+  return compact_chunks(invalidated_fraction_threshold,
+                        std::vector<SegmentEncodingSpec>(column_count(), encoding_spec));
+}
+
+std::vector<ChunkID> Table::compact_chunks(const double invalidated_fraction_threshold,
+                                           const std::vector<SegmentEncodingSpec>& column_encoding_specs) {
+  Assert(column_encoding_specs.size() == column_count(), "Need exactly one encoding spec per column.");
+  Assert(invalidated_fraction_threshold > 0.0 && invalidated_fraction_threshold <= 1.0,
+         "Invalidated fraction threshold must be in (0, 1].");
+
+  auto compacted_chunk_ids = std::vector<ChunkID>{};
+  const auto chunk_count = this->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    const auto mvcc_data = chunk->mvcc_data();
+    const auto chunk_size = chunk->size();
+    if (_chunks.is_mutable(chunk_id) || !mvcc_data || chunk_size == 0) {
+      continue;
+    }
+
+    const auto invalidated_row_count = mvcc_data->invalidated_row_count();
+    if (invalidated_row_count == chunk_size) {
+      _try_to_reclaim_chunk(chunk_id);
+      continue;
+    }
+    if (static_cast<double>(invalidated_row_count) < invalidated_fraction_threshold * chunk_size) {
+      continue;
+    }
+
+    if (_rewrite_chunks({chunk_id}, chunk_size, column_encoding_specs)) {
+      _try_to_reclaim_chunk(chunk_id);
+      compacted_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+  return compacted_chunk_ids;
+}
+
+bool Table::_rewrite_chunks(const std::vector<ChunkID>& chunk_ids, const ChunkOffset max_chunk_size,
+                            const std::vector<SegmentEncodingSpec>& column_encoding_specs) {
+  const auto column_count = this->column_count();
+  auto encoding_specs = column_encoding_specs;
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (_uses_global_dictionary[column_id]) {
+      encoding_specs[column_id] = SegmentEncodingSpec{};
+    }
+  }
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  auto valid_chunk_offsets = std::vector<std::vector<ChunkOffset>>{};
+  auto row_count = uint64_t{0};
+  for (const auto chunk_id : chunk_ids) {
+    const auto& chunk = chunks.emplace_back(get_chunk(chunk_id));
+    const auto mvcc_data = chunk->mvcc_data();
+    auto& chunk_offsets = valid_chunk_offsets.emplace_back();
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->is_invalidated(chunk_offset)) {
+        continue;
+      }
+      if (!transaction_context->try_delete(mvcc_data, chunk_offset)) {
+        transaction_context->rollback();
+        return false;
+      }
+      chunk_offsets.emplace_back(chunk_offset);
+    }
+    row_count += chunk_offsets.size();
+  }
+  if (row_count == 0) {
+    transaction_context->commit();
+    return true;
+  }
+
+  // The rows are distributed evenly over as few chunks as possible. Each chunk is compressed and published as soon as
+  // it is complete. Its rows are not committed yet and thus remain invisible to other transactions.
+  const auto new_chunk_count = (row_count + max_chunk_size - 1) / max_chunk_size;
+  auto new_chunk_sizes =
+      std::vector<ChunkOffset>(new_chunk_count, static_cast<ChunkOffset>(row_count / new_chunk_count));
+  for (auto index = uint64_t{0}; index < row_count % new_chunk_count; ++index) {
+    ++new_chunk_sizes[index];
+  }
+
+  const auto partition_id = _chunks.partition_id(chunk_ids.front());
+  auto new_chunk = _create_mutable_chunk(false);
+  auto new_chunk_index = size_t{0};
+  auto row = std::vector<AllTypeVariant>(column_count);
+  for (auto index = size_t{0}; index < chunks.size(); ++index) {
+    const auto& chunk = chunks[index];
+    auto segments = std::vector<std::shared_ptr<AbstractSegment>>(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(column_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        segments[column_id] =
+            materialize_segment<ColumnDataType>(chunk->get_segment(column_id), column_nullable(column_id));
+      });
+    }
+
+    for (const auto chunk_offset : valid_chunk_offsets[index]) {
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        row[column_id] = (*segments[column_id])[chunk_offset];
+      }
+      new_chunk->append(row);
+      const auto new_chunk_offset = static_cast<ChunkOffset>(new_chunk->size() - 1);
+      new_chunk->mvcc_data()->set_transaction_id(new_chunk_offset, transaction_context->transaction_id());
+      transaction_context->register_insert(new_chunk->mvcc_data(), new_chunk_offset);
+      if (new_chunk->size() < new_chunk_sizes[new_chunk_index]) {
+        continue;
+      }
+
+      _encode_chunk(INVALID_CHUNK_ID, new_chunk, encoding_specs, [&](const std::shared_ptr<Chunk>& rewritten_chunk) {
+        _add_immutable_chunk(rewritten_chunk, partition_id);
+        _row_count += rewritten_chunk->size();
+      });
+      new_chunk = _create_mutable_chunk(false);
+      ++new_chunk_index;
+    }
+  }
+  transaction_context->commit();
+  return true;
+}
+
+bool Table::_try_to_reclaim_chunk(const ChunkID chunk_id) {
+  const auto chunk = get_chunk(chunk_id);
+  const auto mvcc_data = chunk->mvcc_data();
+  const auto chunk_size = chunk->size();
+  if (_chunks.is_mutable(chunk_id) || !mvcc_data || chunk_size == 0 ||
+      mvcc_data->invalidated_row_count() != chunk_size) {
+    return false;
+  }
+
+  // Rows that were never committed or deleted before the oldest active snapshot are not visible to anyone.
+  const auto lowest_active_snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (mvcc_data->begin_commit_id(chunk_offset) != MAX_COMMIT_ID &&
+        mvcc_data->end_commit_id(chunk_offset) > lowest_active_snapshot_commit_id) {
+      return false;
+    }
+  }
+
+  const auto lock = std::lock_guard{_chunk_mutex};
+  // Another thread might have reclaimed the chunk in the meantime. Readers that pinned the chunk ids might still access
+  // the chunk through their positions. Readers that pin them later cannot see its rows anymore.
+  if (get_chunk(chunk_id) != chunk || *_chunk_id_pin_count != 0) {
+    return false;
+  }
+  _chunks.replace(chunk_id, _create_mutable_chunk(false));
+  _row_count -= chunk_size;
+  return true;
+}
+
+void Table::partition_by_hash(const ColumnID column_id, const PartitionID partition_count) {
+  Assert(column_id < column_count(), "Tried to partition by a non-existent column.");
+  resolve_data_type(column_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    _set_partitioning(std::make_shared<HashPartitioning<ColumnDataType>>(column_id, partition_count));
+  });
+}
+
+void Table::partition_by_range(const ColumnID column_id, const std::vector<AllTypeVariant>& bounds) {
+  Assert(column_id < column_count(), "Tried to partition by a non-existent column.");
+  resolve_data_type(column_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    _set_partitioning(std::make_shared<RangePartitioning<ColumnDataType>>(column_id, bounds));
+  });
+}
+
+void Table::_set_partitioning(const std::shared_ptr<const AbstractPartitioning>& partitioning) {
+  Assert(row_count() == 0, "Tried to partition non-empty table.");
+  const auto lock = std::lock_guard{_chunk_mutex};
+  _partitioning = partitioning;
+
+  // The existing (empty) chunks belong to the first partition. Chunks of the other partitions are created when the
+  // first row of the partition is appended.
+  _partition_last_chunk_ids.assign(partitioning->partition_count(), INVALID_CHUNK_ID);
+  _partition_last_chunk_ids[0] = static_cast<ChunkID>(chunk_count() - 1);
+}
+
+std::shared_ptr<const AbstractPartitioning> Table::partitioning() const {
+  return _partitioning;
+}
+
+PartitionID Table::partition_count() const {
+  return static_cast<PartitionID>(_partition_last_chunk_ids.size());
+}
+
+PartitionID Table::partition_id(const ChunkID chunk_id) const {
+  return _chunks.partition_id(chunk_id);
+}
+
+std::vector<ChunkID> Table::partition_chunk_ids(const PartitionID partition_id) const {
+  Assert(partition_id < partition_count(), "Tried to get the chunks of a non-existent partition.");
+  auto chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    if (_chunks.partition_id(chunk_id) == partition_id) {
+      chunk_ids.emplace_back(chunk_id);
+    }
+  }
+  return chunk_ids;
+}
+
+void Table::use_block_zone_maps(const ChunkOffset block_size) {
+  Assert(row_count() == 0, "Tried to enable block zone maps on non-empty table.");
+  Assert(block_size > 0, "Block size of zone maps must be positive.");
+  const auto lock = std::lock_guard{_chunk_mutex};
+  _zone_map_block_size = block_size;
+
+  // Replace the segments of the (empty) last chunk.
+  _chunks.replace(static_cast<ChunkID>(chunk_count() - 1), _create_mutable_chunk(_uses_delta_store));
+}
+
+ChunkOffset Table::zone_map_block_size() const {
+  return _zone_map_block_size;
+}
+
+void Table::_replace_segment(const ChunkID chunk_id, const ColumnID column_id,
+                             const std::shared_ptr<AbstractSegment>& segment,
+                             const std::shared_ptr<const BloomFilter>& bloom_filter) {
+  const auto chunk = get_chunk(chunk_id);
+  auto new_chunk = std::make_shared<Chunk>();
+  new_chunk->set_mvcc_data(chunk->mvcc_data());
+  for (auto segment_column_id = ColumnID{0}; segment_column_id < chunk->column_count(); ++segment_column_id) {
+    if (segment_column_id == column_id) {
+      new_chunk->add_segment(segment, chunk->get_zone_map(segment_column_id), bloom_filter);
+    } else {
+      new_chunk->add_segment(chunk->get_segment(segment_column_id), chunk->get_zone_map(segment_column_id),
+                             chunk->get_bloom_filter(segment_column_id));
+    }
+    // The values of the new segment are the same, so that it is sorted in the same way.
+    if (const auto sort_mode = chunk->sort_mode(segment_column_id)) {
+      new_chunk->set_sort_mode(segment_column_id, *sort_mode);
+    }
+  }
+  _chunks.replace(chunk_id, new_chunk);
 }
 
 }  // namespace opossum
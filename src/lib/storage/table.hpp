@@ -1,15 +1,30 @@
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+
 #include "abstract_segment.hpp"
 #include "chunk.hpp"
+#include "chunk_directory.hpp"
 #include "type_cast.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
+class AbstractColumnBatch;
+class AbstractPartitioning;
+class BloomFilter;
+class EncodingAdvisor;
+struct SegmentEncodingReport;
 class TableStatistics;
+class TransactionContext;
 
 // A table is partitioned horizontally into a number of chunks
 class Table : private Noncopyable {
+  friend class TableWriter;
+
  public:
   // Creates a table. The parameter specifies the maximum chunk size, i.e., partition size default is the maximum chunk
   // size minus 1. A table always holds at least one chunk.
@@ -26,6 +41,10 @@ class Table : private Noncopyable {
   // approximate count of valid rows instead.
   uint64_t row_count() const;
 
+  // Returns the number of rows minus the number of invalidated rows (see MvccData). It is approximate because rows may
+  // be appended or invalidated concurrently.
+  uint64_t approx_valid_row_count() const;
+
   // Returns the number of chunks (cannot exceed ChunkID (uint32_t)).
   ChunkID chunk_count() const;
 
@@ -33,6 +52,16 @@ class Table : private Noncopyable {
   std::shared_ptr<Chunk> get_chunk(const ChunkID chunk_id);
   std::shared_ptr<const Chunk> get_chunk(const ChunkID chunk_id) const;
 
+  // Returns a handle that keeps the ids of the table's chunks stable while it is alive: No chunk is replaced by an
+  // empty chunk and no id is reused (see compact_chunks). ReferenceSegments hold it as long as they refer to the
+  // table, and operators take it before they collect positions in the table, as readers outside of transactions are
+  // not protected by a snapshot.
+  std::shared_ptr<const void> pin_chunk_ids() const;
+
+  // Returns whether rows may still be appended to the chunk. Readers of mutable chunks have to read the chunk's size
+  // before its rows and must not rely on its zone maps, which are updated after the rows.
+  bool is_chunk_mutable(const ChunkID chunk_id) const;
+
   // Returns a list of all column names.
   const std::vector<std::string>& column_names() const;
 
@@ -60,28 +89,221 @@ class Table : private Noncopyable {
   // entries, because we would otherwise have to deal with default values.
   void add_column(const std::string& name, const std::string& type, const bool nullable);
 
-  // Inserts a row at the end of the table. Note this is slow and not thread-safe and should be used for testing
-  // purposes only.
+  // Inserts a row at the end of the table. Note this is slow and should be used for testing purposes only. Appends
+  // from multiple threads are serialized. Use a TableWriter per thread for concurrent ingestion. The row is committed
+  // right away, i.e., it is visible to all transactions that start afterwards.
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Same as append above, but the row is inserted by the transaction and becomes visible to others when it commits.
+  void append(const std::vector<AllTypeVariant>& values, TransactionContext& transaction_context);
+
+  // Appends the rows of the column batches, one per column and all of the same size, at the end of the table. The
+  // values are copied into the segments as they are, so that the batches have to match the columns' data types. This
+  // is the fast path for bulk loading: There is no per-value casting or dispatch except for the partitioning column of
+  // partitioned tables. Appends from multiple threads are serialized. All rows are committed at once.
+  void append_columns(const std::vector<std::shared_ptr<const AbstractColumnBatch>>& column_batches);
+
   // Creates a new chunk and appends it.
   void create_new_chunk();
 
-  // Compresses a ValueColumn into a DictionaryColumn.
-  void compress_chunk(const ChunkID chunk_id);
+  // Compresses the ValueSegments of a chunk into the given encoding (DictionarySegments by default) and marks the chunk
+  // as immutable.
+  void compress_chunk(const ChunkID chunk_id, const SegmentEncodingSpec& encoding_spec = SegmentEncodingSpec{});
+
+  // Same as compress_chunk above, but with one encoding per column.
+  void compress_chunk(const ChunkID chunk_id, const std::vector<SegmentEncodingSpec>& column_encoding_specs);
+
+  // Same as compress_chunk above, but the encoding of each column is chosen by the given advisor. Returns the chosen
+  // encodings with their expected and actual memory usage.
+  std::vector<SegmentEncodingReport> compress_chunk(const ChunkID chunk_id, const EncodingAdvisor& encoding_advisor);
+
+  // Lets all DictionarySegments of the column share one sorted dictionary. The segments of immutable chunks, which have
+  // to be ValueSegments or DictionarySegments, are re-encoded right away. Chunks compressed later on reuse the
+  // dictionary if it contains all of their values. Otherwise, the dictionary is rebuilt and the column's segments in
+  // all other immutable chunks are re-encoded. Hence, ValueIDs of the column are comparable across chunks. Such columns
+  // can only be dictionary-encoded.
+  void use_global_dictionary(const ColumnID column_id);
+
+  // Returns whether the nth column uses a table-wide dictionary.
+  bool uses_global_dictionary(const ColumnID column_id) const;
+
+  // Keeps a Bloom filter of the values of each of the column's immutable segments, which allows equality scans to skip
+  // chunks that do not contain the search value even if it lies within their value range. Filters are built for
+  // the existing immutable chunks right away and for other chunks when they are compressed.
+  void use_bloom_filter(const ColumnID column_id);
+
+  // Returns whether the nth column keeps Bloom filters.
+  bool uses_bloom_filter(const ColumnID column_id) const;
+
+  // Splits the table into a write-optimized delta and a read-optimized main. New rows are appended to delta chunks
+  // with UnsortedDictionarySegments, which merge_delta encodes into immutable main chunks with the given encoding
+  // (e.g., periodically from a DeltaMerger). Can only be enabled on an empty table.
+  void use_delta_store(const SegmentEncodingSpec& main_encoding_spec = SegmentEncodingSpec{});
+
+  // Returns whether new rows are appended to a delta store.
+  bool uses_delta_store() const;
+
+  // Merges all full delta chunks into the main, i.e., encodes and marks them as immutable, and returns their ids. The
+  // chunks are replaced one by one, so that concurrent readers see each row either in the delta or in the main.
+  std::vector<ChunkID> merge_delta();
+
+  // Rewrites the table so that its rows are ordered by the given clustering columns (ascending, NULL values last),
+  // with the first column being the most significant. Rows with equal keys keep their order. The rows are split into
+  // chunks of the target chunk size, which are compressed with the given encoding (or with the table's global
+  // dictionaries). Thus, zone maps and sortedness metadata can prune most chunks for predicates on the first clustering
+  // column. The whole table is materialized during clustering. Must not run concurrently with appends, scans, or
+  // transactions that modify the table. The rows keep their versioning information.
+  void cluster(const std::vector<ColumnID>& clustering_column_ids,
+               const SegmentEncodingSpec& encoding_spec = SegmentEncodingSpec{});
+
+  // Same as cluster above, but with one encoding per column.
+  void cluster(const std::vector<ColumnID>& clustering_column_ids,
+               const std::vector<SegmentEncodingSpec>& column_encoding_specs);
+
+  // Brings the numbers of valid rows of immutable chunks between min_chunk_size and max_chunk_size: Consecutive
+  // immutable chunks of a partition that are too large or too small are rewritten into new chunks of about equal size,
+  // which are compressed with the given encoding. A too small chunk whose neighbours have the right size is merged
+  // with one of them. The target chunk size for appended rows is not changed. Like compact_chunks, each group of chunks
+  // is rewritten by a transaction, so that readers see either the old or the new chunks (see TableScan). Other chunks
+  // keep their ids. The old chunks are replaced by empty chunks once no running transaction can see them anymore.
+  // Groups with rows that are held by running transactions are skipped. Must not run concurrently with cluster.
+  void rebalance_chunks(const ChunkOffset min_chunk_size, const ChunkOffset max_chunk_size,
+                        const SegmentEncodingSpec& encoding_spec = SegmentEncodingSpec{});
+
+  // Same as rebalance_chunks above, but with one encoding per column.
+  void rebalance_chunks(const ChunkOffset min_chunk_size, const ChunkOffset max_chunk_size,
+                        const std::vector<SegmentEncodingSpec>& column_encoding_specs);
+
+  // Rewrites immutable chunks in which at least the given fraction of rows is invalidated: The valid rows are moved to
+  // a new immutable chunk of the same partition, which is compressed with the given encoding, by a transaction that
+  // deletes them from the old chunk and inserts them into the new one. Thus, running transactions still see the rows
+  // in the old chunk. Chunks whose rows are all invalidated and not visible to any transaction anymore, which includes
+  // compacted chunks once the running transactions have finished, are replaced by empty chunks, which frees their
+  // memory. The ids of these empty chunks are reused for chunks that are rewritten or sealed later on, so that the
+  // number of chunks does not grow with every compaction. Neither happens while positions into the table, e.g., the
+  // output of earlier scans, pin the chunk ids (see pin_chunk_ids). Chunks with rows that are held by running
+  // transactions are skipped. Returns the ids of the rewritten chunks. Must not run concurrently with cluster.
+  std::vector<ChunkID> compact_chunks(const double invalidated_fraction_threshold,
+                                      const SegmentEncodingSpec& encoding_spec = SegmentEncodingSpec{});
+
+  // Same as compact_chunks above, but with one encoding per column.
+  std::vector<ChunkID> compact_chunks(const double invalidated_fraction_threshold,
+                                      const std::vector<SegmentEncodingSpec>& column_encoding_specs);
+
+  // Splits the table into partitions by the hash of the column's values (see HashPartitioning). Each partition has its
+  // own chunks, to which append adds the rows of the partition. Can only be enabled on an empty table.
+  void partition_by_hash(const ColumnID column_id, const PartitionID partition_count);
+
+  // Same as partition_by_hash above, but by ranges of the column's values between the given ascending bounds (see
+  // RangePartitioning).
+  void partition_by_range(const ColumnID column_id, const std::vector<AllTypeVariant>& bounds);
+
+  // Returns the partitioning of the table or nullptr if the table is not partitioned.
+  std::shared_ptr<const AbstractPartitioning> partitioning() const;
+
+  // Returns the number of partitions, which is 1 for tables that are not partitioned.
+  PartitionID partition_count() const;
+
+  // Returns the partition that the rows of the chunk belong to.
+  PartitionID partition_id(const ChunkID chunk_id) const;
+
+  // Returns the ids of the chunks of a partition in ascending order.
+  std::vector<ChunkID> partition_chunk_ids(const PartitionID partition_id) const;
+
+  // Every segment that rows are appended to has a zone map with its minimum, maximum, and NULL count, which scans use
+  // to skip chunks. Additionally, keep these statistics for every block of block_size rows within the segments, so
+  // that scans can skip parts of chunks. Can only be enabled on an empty table.
+  void use_block_zone_maps(const ChunkOffset block_size = AbstractZoneMap::DEFAULT_BLOCK_SIZE);
+
+  // Returns the number of rows per block of the zone maps or 0 if only statistics per segment are kept.
+  ChunkOffset zone_map_block_size() const;
 
  private:
   std::shared_ptr<Chunk> last_chunk();
 
+  // Appends the row as uncommitted to the last chunk of its partition, which is returned. The caller has to hold
+  // _chunk_mutex.
+  std::shared_ptr<Chunk> _append(const std::vector<AllTypeVariant>& values);
+
+  // Same as create_new_chunk, but for the given partition. The caller has to hold _chunk_mutex.
+  void _create_new_chunk(const PartitionID partition_id = PartitionID{0});
+
+  // Creates a chunk with empty ValueSegments or, for delta chunks, UnsortedDictionarySegments, their zone maps, and
+  // MvccData.
+  std::shared_ptr<Chunk> _create_mutable_chunk(const bool is_delta) const;
+
+  // Returns the encoding of each column for merging delta chunks into the main.
+  std::vector<SegmentEncodingSpec> _main_encoding_specs() const;
+
+  // Publishes a full chunk of a TableWriter as an immutable chunk of the given partition. Chunks of tables with a delta
+  // store are encoded like merged delta chunks first. The rows of the chunk are committed at once.
+  void _publish_sealed_chunk(const std::shared_ptr<Chunk>& chunk, const PartitionID partition_id);
+
+  // Adds an immutable chunk to the partition. It takes the id of an empty immutable chunk of the partition, i.e., of a
+  // reclaimed chunk, if there is one and the chunk ids are not pinned. The caller has to hold _chunk_mutex.
+  void _add_immutable_chunk(const std::shared_ptr<Chunk>& chunk, const PartitionID partition_id);
+
+  // Moves the valid rows of the given immutable chunks of a partition, in this order, into new immutable chunks of the
+  // partition with at most max_chunk_size rows each, which are compressed with the given encoding (or with the table's
+  // global dictionaries). A transaction deletes the rows from the old chunks and inserts them into the new ones, so
+  // that running transactions still see the old chunks. Returns false without changes if rows of the chunks are held
+  // by other transactions.
+  bool _rewrite_chunks(const std::vector<ChunkID>& chunk_ids, const ChunkOffset max_chunk_size,
+                       const std::vector<SegmentEncodingSpec>& column_encoding_specs);
+
+  // Replaces an immutable chunk whose rows are all invalidated and not visible to any transaction anymore by an empty
+  // chunk, which frees its memory. Chunks are not replaced while the chunk ids are pinned. Returns whether the chunk
+  // was replaced.
+  bool _try_to_reclaim_chunk(const ChunkID chunk_id);
+
+  // Sets the partitioning of the (empty) table.
+  void _set_partitioning(const std::shared_ptr<const AbstractPartitioning>& partitioning);
+
+  // Encodes the segments of the chunk (see compress_chunk) and passes the encoded chunk to publish, which adds it to
+  // the table. publish is called while holding _chunk_mutex, under which the columns with a global dictionary were
+  // encoded. Thus, no other chunk can rebuild the dictionary before the encoded chunk is part of the table.
+  void _encode_chunk(const ChunkID chunk_id, const std::shared_ptr<const Chunk>& chunk,
+                     const std::vector<SegmentEncodingSpec>& column_encoding_specs,
+                     const std::function<void(const std::shared_ptr<Chunk>&)>& publish);
+
+  // Encodes the segment of the given chunk with the global dictionary of the column (see use_global_dictionary). If
+  // segment is nullptr, only the segments of immutable chunks are re-encoded with a rebuilt dictionary. The caller has
+  // to hold _chunk_mutex.
+  std::shared_ptr<AbstractSegment> _encode_with_global_dictionary(const ColumnID column_id, const ChunkID chunk_id,
+                                                                  const std::shared_ptr<AbstractSegment>& segment,
+                                                                  const VectorCompressionType vector_compression_type);
+
+  // Replaces the segment and the Bloom filter of an immutable chunk by creating a new chunk with the remaining
+  // segments. The caller has to hold _chunk_mutex.
+  void _replace_segment(const ChunkID chunk_id, const ColumnID column_id,
+                        const std::shared_ptr<AbstractSegment>& segment,
+                        const std::shared_ptr<const BloomFilter>& bloom_filter);
+
  protected:
-  std::vector<std::shared_ptr<Chunk>> _chunks;
-  std::vector<bool> _is_chunk_mutable;
+  ChunkDirectory _chunks;
+  // The chunk of each partition that rows are appended to.
+  std::vector<ChunkID> _partition_last_chunk_ids;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
   std::vector<bool> _is_column_nullable;
+  // Set by use_global_dictionary under _chunk_mutex, but read without it, e.g., by the encoding threads. Stored in a
+  // deque, as atomics cannot be moved when a vector grows.
+  std::deque<std::atomic<bool>> _uses_global_dictionary;
+  std::vector<bool> _uses_bloom_filter;
 
   ChunkOffset _target_chunk_size;
-  uint64_t _row_count;
+  std::atomic<uint64_t> _row_count;
+
+  bool _uses_delta_store{false};
+  SegmentEncodingSpec _main_encoding_spec;
+  ChunkOffset _zone_map_block_size{0};
+  std::shared_ptr<const AbstractPartitioning> _partitioning;
+  // Serializes the writers of the chunk directory and the partitions' chunks, i.e., appends, compressions, and merges
+  // of the delta. Readers of the chunk directory do not need it.
+  std::mutex _chunk_mutex;
+  // Number of live handles returned by pin_chunk_ids. The handles share the counter, so that they may outlive the
+  // table.
+  std::shared_ptr<std::atomic<uint64_t>> _chunk_id_pin_count{std::make_shared<std::atomic<uint64_t>>(0)};
 };
 
 }  // namespace opossum
@@ -0,0 +1,46 @@
+#include "table_writer.hpp"
+
+#include "chunk.hpp"
+#include "partitioning.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableWriter::TableWriter(Table& table) : _table{table}, _chunks(table.partition_count()) {}
+
+TableWriter::~TableWriter() {
+  flush();
+}
+
+void TableWriter::append(const std::vector<AllTypeVariant>& values) {
+  DebugAssert(values.size() == _table.column_count(), "Tried to append row with unfitting number of columns.");
+  const auto& partitioning = _table._partitioning;
+  const auto partition_id = partitioning ? partitioning->partition(values[partitioning->column_id()]) : PartitionID{0};
+
+  auto& chunk = _chunks[partition_id];
+  if (!chunk) {
+    // The rows are appended to ValueSegments, even if the table uses a delta store, since the chunk is encoded as a
+    // whole when it is sealed.
+    chunk = _table._create_mutable_chunk(false);
+  }
+  chunk->append(values);
+  if (chunk->size() >= _table.target_chunk_size()) {
+    _seal_chunk(partition_id);
+  }
+}
+
+void TableWriter::flush() {
+  for (auto partition_id = PartitionID{0}; partition_id < _chunks.size(); ++partition_id) {
+    if (_chunks[partition_id] && _chunks[partition_id]->size() > 0) {
+      _seal_chunk(partition_id);
+    }
+  }
+}
+
+void TableWriter::_seal_chunk(const PartitionID partition_id) {
+  _table._publish_sealed_chunk(_chunks[partition_id], partition_id);
+  _chunks[partition_id] = nullptr;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// A TableWriter appends rows to a table from a single thread. Each writer fills its own chunks (one per partition)
+// without synchronizing with other writers. Once a chunk reaches the table's target chunk size, it is sealed, i.e.,
+// marked as immutable (and merged into the main if the table uses a delta store), and published in the table's chunk
+// directory, which is the only step that takes a lock. Thus, one writer per thread lets many threads ingest rows
+// concurrently. Rows become visible when their chunk is published, whose rows are committed at once, i.e., at the
+// latest when flush is called or the writer is destroyed. The table's options must not be changed while writers are
+// active.
+class TableWriter : private Noncopyable {
+ public:
+  explicit TableWriter(Table& table);
+
+  // Publishes the remaining rows.
+  ~TableWriter();
+
+  // Adds a row to the writer's chunk of the row's partition.
+  void append(const std::vector<AllTypeVariant>& values);
+
+  // Seals and publishes the writer's non-empty chunks, even if they are not full.
+  void flush();
+
+ protected:
+  void _seal_chunk(const PartitionID partition_id);
+
+  Table& _table;
+  std::vector<std::shared_ptr<Chunk>> _chunks;
+};
+
+}  // namespace opossum
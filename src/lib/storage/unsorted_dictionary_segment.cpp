@@ -0,0 +1,145 @@
+#include "unsorted_dictionary_segment.hpp"
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+UnsortedDictionarySegment<T>::UnsortedDictionarySegment(bool nullable) : _is_nullable{nullable} {}
+
+template <typename T>
+AllTypeVariant UnsortedDictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  if (const auto optional_value = get_typed_value(chunk_offset)) {
+    return *optional_value;
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+T UnsortedDictionarySegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional_value = get_typed_value(chunk_offset);
+  Assert(optional_value.has_value(),
+         "Tried to `.get` value at offset " + std::to_string(chunk_offset) + " that was NULL.");
+  return *optional_value;
+}
+
+template <typename T>
+std::optional<T> UnsortedDictionarySegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < _value_ids.size(), "Tried to access UnsortedDictionarySegment out of bounds.");
+  const auto value_id = _value_ids[chunk_offset];
+  if (value_id == null_value_id()) {
+    return std::nullopt;
+  }
+  return value_of_value_id(value_id);
+}
+
+template <typename T>
+void UnsortedDictionarySegment<T>::append(const AllTypeVariant& value) {
+  if (variant_is_null(value)) {
+    Assert(is_nullable(), "Tried to append NULL value into non-nullable UnsortedDictionarySegment.");
+    _value_ids.push_back(null_value_id());
+    return;
+  }
+
+  auto typed_value = T{};
+  try {
+    typed_value = type_cast<T>(value);
+  } catch (...) {
+    Fail("Tried to append inconvertible value to UnsortedDictionarySegment.");
+  }
+  _append_value(typed_value);
+}
+
+template <typename T>
+void UnsortedDictionarySegment<T>::append(const std::span<const T> values, const Bitmap* null_values,
+                                          const size_t null_offset) {
+  DebugAssert(!null_values || null_offset + values.size() <= null_values->size(), "NULL bitmap is too short.");
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    if (null_values && (*null_values)[null_offset + index]) {
+      Assert(is_nullable(), "Tried to append NULL value into non-nullable UnsortedDictionarySegment.");
+      _value_ids.push_back(null_value_id());
+    } else {
+      _append_value(values[index]);
+    }
+  }
+}
+
+template <typename T>
+void UnsortedDictionarySegment<T>::_append_value(const T& typed_value) {
+  const auto next_value_id = ValueID{static_cast<ValueID::base_type>(_dictionary.size())};
+  const auto [iterator, inserted] = _value_id_by_value.try_emplace(typed_value, next_value_id);
+  if (inserted) {
+    Assert(next_value_id != INVALID_VALUE_ID, "UnsortedDictionarySegment ran out of ValueIDs.");
+    if constexpr (std::is_same_v<T, std::string>) {
+      _dictionary.push_back(_arena.store(typed_value));
+    } else {
+      _dictionary.push_back(typed_value);
+    }
+  }
+  _value_ids.push_back(iterator->second);
+}
+
+template <typename T>
+bool UnsortedDictionarySegment<T>::is_nullable() const {
+  return _is_nullable;
+}
+
+template <typename T>
+std::span<const typename UnsortedDictionarySegment<T>::StoredType> UnsortedDictionarySegment<T>::dictionary() const {
+  return _dictionary.span();
+}
+
+template <typename T>
+std::span<const ValueID> UnsortedDictionarySegment<T>::value_ids() const {
+  return _value_ids.span();
+}
+
+template <typename T>
+ValueID UnsortedDictionarySegment<T>::null_value_id() const {
+  return INVALID_VALUE_ID;
+}
+
+template <typename T>
+T UnsortedDictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
+  Assert(value_id < _dictionary.size(), "Tried to get value for value id that is not in the dictionary.");
+  return T{_dictionary[value_id]};
+}
+
+template <typename T>
+ChunkOffset UnsortedDictionarySegment<T>::unique_values_count() const {
+  return static_cast<ChunkOffset>(_dictionary.size());
+}
+
+template <typename T>
+std::shared_ptr<ValueSegment<T>> UnsortedDictionarySegment<T>::materialize() const {
+  auto value_segment = std::make_shared<ValueSegment<T>>(_is_nullable);
+  for (const auto value_id : value_ids()) {
+    if (value_id == null_value_id()) {
+      value_segment->append(NULL_VALUE);
+    } else {
+      value_segment->append(value_of_value_id(value_id));
+    }
+  }
+  return value_segment;
+}
+
+template <typename T>
+ChunkOffset UnsortedDictionarySegment<T>::size() const {
+  return static_cast<ChunkOffset>(_value_ids.size());
+}
+
+template <typename T>
+size_t UnsortedDictionarySegment<T>::estimate_memory_usage() const {
+  // The hash map is not included, as it only speeds up appending.
+  auto dictionary_memory = _dictionary.size() * sizeof(StoredType);
+  if constexpr (std::is_same_v<T, std::string>) {
+    dictionary_memory += _arena.estimate_memory_usage();
+  }
+  return _value_ids.size() * sizeof(ValueID) + dictionary_memory;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(UnsortedDictionarySegment);
+
+}  // namespace opossum
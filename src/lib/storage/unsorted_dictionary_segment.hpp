@@ -0,0 +1,88 @@
+#pragma once
+
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_segment.hpp"
+#include "bitmap.hpp"
+#include "inline_string.hpp"
+#include "stable_vector.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueSegment;
+
+// UnsortedDictionarySegment is the write-optimized segment type of a table's delta store (see Table::use_delta_store).
+// Like a DictionarySegment, it stores each distinct value once and references it by ValueID, but the dictionary is
+// kept in insertion order so that appending never has to renumber existing ValueIDs. A hash map finds the ValueID of
+// an already known value. The ValueIDs are stored uncompressed, NULL values are represented by INVALID_VALUE_ID.
+// Like in a ValueSegment, strings are stored as InlineStrings whose characters are owned by the segment's StringArena.
+// Appending is not thread-safe, but as the dictionary and the ValueIDs are kept in StableVectors and a new value is
+// added to the dictionary before its ValueID is appended, a single writer may append while others read the rows before
+// the size they read first.
+template <typename T>
+class UnsortedDictionarySegment : public AbstractSegment {
+ public:
+  using StoredType = std::conditional_t<std::is_same_v<T, std::string>, InlineString, T>;
+
+  explicit UnsortedDictionarySegment(bool nullable = false);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Adds a value at the end of the segment.
+  void append(const AllTypeVariant& value);
+
+  // Adds the values at the end of the segment without casting them. If null_values is given, values[i] is NULL if the
+  // bit null_offset + i is set.
+  void append(const std::span<const T> values, const Bitmap* null_values = nullptr, const size_t null_offset = 0);
+
+  // Returns whether segment supports NULL values.
+  bool is_nullable() const;
+
+  // Returns the distinct values in the order in which they were first appended.
+  std::span<const StoredType> dictionary() const;
+
+  // Returns the ValueID of each row.
+  std::span<const ValueID> value_ids() const;
+
+  // Returns the ValueID used to represent a NULL value.
+  ValueID null_value_id() const;
+
+  // Returns the value represented by a given ValueID.
+  T value_of_value_id(const ValueID value_id) const;
+
+  // Returns the number of unique_values (dictionary entries).
+  ChunkOffset unique_values_count() const;
+
+  // Copies the values into a ValueSegment, e.g., to encode them with an encoding that requires one.
+  std::shared_ptr<ValueSegment<T>> materialize() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const final;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  void _append_value(const T& value);
+
+  StableVector<StoredType> _dictionary;
+  // Only used by UnsortedDictionarySegment<std::string>.
+  StringArena _arena;
+  std::unordered_map<T, ValueID> _value_id_by_value;
+  StableVector<ValueID> _value_ids;
+  bool _is_nullable;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(UnsortedDictionarySegment);
+
+}  // namespace opossum
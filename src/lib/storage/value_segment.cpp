@@ -19,13 +19,15 @@ AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const
 
 template <typename T>
 bool ValueSegment<T>::is_null(const ChunkOffset chunk_offset) const {
-  return is_nullable() && null_values().at(chunk_offset);
+  return is_nullable() && _null_values[chunk_offset];
 }
 
 template <typename T>
 T ValueSegment<T>::get(const ChunkOffset chunk_offset) const {
   Assert(!is_null(chunk_offset), "Tried to .get a NULL value from a ValueSegment.");
-  return values().at(chunk_offset);
+  const auto values = this->values();
+  Assert(chunk_offset < values.size(), "Tried to .get a value out of the bounds of a ValueSegment.");
+  return T{values[chunk_offset]};
 }
 
 template <typename T>
@@ -38,31 +40,76 @@ std::optional<T> ValueSegment<T>::get_typed_value(const ChunkOffset chunk_offset
 
 template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& value) {
+  // The NULL value is added first, as appending to _values publishes the row.
   if (variant_is_null(value)) {
     Assert(is_nullable(), "Tried to append NULL value into non-nullable ValueSegment.");
-    _values.emplace_back();
-    _null_values.emplace_back(true);
-  } else {
-    try {
-      _values.emplace_back(type_cast<T>(value));
-    } catch (...) {
-      Fail("Tried to append inconvertible value to ValueSegment.");
+    _null_values.push_back(true);
+    _values.push_back(StoredType{});
+    return;
+  }
+
+  auto stored_value = StoredType{};
+  try {
+    if constexpr (std::is_same_v<T, std::string>) {
+      if (const auto* const string = boost::get<std::string>(&value)) {
+        stored_value = _arena.store(*string);
+      } else {
+        stored_value = _arena.store(type_cast<std::string>(value));
+      }
+    } else {
+      stored_value = type_cast<T>(value);
     }
+  } catch (...) {
+    Fail("Tried to append inconvertible value to ValueSegment.");
+  }
+
+  if (is_nullable()) {
+    _null_values.push_back(false);
+  }
+  _values.push_back(stored_value);
+}
 
-    if (is_nullable()) {
-      _null_values.emplace_back(false);
+template <typename T>
+void ValueSegment<T>::append(const std::span<const T> values, const Bitmap* null_values, const size_t null_offset) {
+  const auto value_count = values.size();
+  DebugAssert(!null_values || null_offset + value_count <= null_values->size(), "NULL bitmap is too short.");
+  const auto has_nulls = null_values && null_values->find_next_set(null_offset) < null_offset + value_count;
+  Assert(!has_nulls || is_nullable(), "Tried to append NULL value into non-nullable ValueSegment.");
+
+  if (is_nullable()) {
+    for (auto index = size_t{0}; index < value_count; ++index) {
+      _null_values.push_back(has_nulls && (*null_values)[null_offset + index]);
+    }
+  }
+
+  // Like single NULL values, NULL values are stored as default-constructed values.
+  if constexpr (std::is_same_v<T, std::string>) {
+    _values.reserve(_values.size() + value_count);
+    for (auto index = size_t{0}; index < value_count; ++index) {
+      if (has_nulls && (*null_values)[null_offset + index]) {
+        _values.push_back(StoredType{});
+      } else {
+        _values.push_back(_arena.store(values[index]));
+      }
+    }
+  } else if (has_nulls) {
+    _values.reserve(_values.size() + value_count);
+    for (auto index = size_t{0}; index < value_count; ++index) {
+      _values.push_back((*null_values)[null_offset + index] ? T{} : values[index]);
     }
+  } else {
+    _values.append(values);
   }
 }
 
 template <typename T>
 ChunkOffset ValueSegment<T>::size() const {
-  return values().size();
+  return _values.size();
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
-  return _values;
+std::span<const typename ValueSegment<T>::StoredType> ValueSegment<T>::values() const {
+  return _values.span();
 }
 
 template <typename T>
@@ -71,7 +118,7 @@ bool ValueSegment<T>::is_nullable() const {
 }
 
 template <typename T>
-const std::vector<bool>& ValueSegment<T>::null_values() const {
+const Bitmap& ValueSegment<T>::null_values() const {
   Assert(is_nullable(), "Tried to get null_values of non-nullable ValueSegment.");
   return _null_values;
 }
@@ -83,8 +130,8 @@ size_t ValueSegment<T>::estimate_memory_usage() const {
   //
   //            values().capacity() * sizeof(T) + null_values().capacity() / 8
   //
-  //        to bring the _null_values vector into the equation and include the additional capacity of the vectors.
-  return values().size() * sizeof(T);
+  //        to bring the _null_values bitmap into the equation and include the additional capacity of the vectors.
+  return values().size() * sizeof(StoredType) + _arena.estimate_memory_usage();
 }
 
 // Macro to instantiate the following classes:
@@ -1,13 +1,23 @@
 #pragma once
 
+#include <span>
+
 #include "abstract_segment.hpp"
+#include "bitmap.hpp"
+#include "inline_string.hpp"
+#include "stable_vector.hpp"
 
 namespace opossum {
 
-// ValueSegment is a segment type that stores all its values in a vector.
+// ValueSegment is a segment type that stores all its values in a vector. Strings are stored as InlineStrings whose
+// characters are owned by the segment's StringArena, so that appending does not allocate per string. The values and
+// NULL values are kept in StableVectors and a value is only counted by size() after it has been written completely.
+// Thus, a single writer may append while others read the values before the size they read first (see TableScan).
 template <typename T>
 class ValueSegment : public AbstractSegment {
  public:
+  using StoredType = std::conditional_t<std::is_same_v<T, std::string>, InlineString, T>;
+
   explicit ValueSegment(bool nullable = false);
 
   // Returns the value at a certain position. If you want to write efficient operators, back off!
@@ -25,28 +35,34 @@ class ValueSegment : public AbstractSegment {
   // Adds a value at the end of the segment.
   void append(const AllTypeVariant& value);
 
+  // Adds the values at the end of the segment without casting them. If null_values is given, values[i] is NULL if the
+  // bit null_offset + i is set.
+  void append(const std::span<const T> values, const Bitmap* null_values = nullptr, const size_t null_offset = 0);
+
   // Returns the number of entries.
   ChunkOffset size() const final;
 
   // Returns all values. This is the preferred method to check a value at a certain index. Usually you need to access
   // more than a single value anyway.
-  // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  // e.g. const auto values = value_segment.values(); and then: values[i]; in your loop.
+  std::span<const StoredType> values() const;
 
   // Returns whether segment supports NULL values.
   bool is_nullable() const;
 
-  // Returns NULL value vector that indicates whether a value is NULL with true at position i. Throw an exception if
+  // Returns NULL value bitmap that indicates whether a value is NULL with true at position i. Throw an exception if
   // is_nullable() returns false. This is the preferred method to check for a NULL value at a certain index. Usually
   // you need to access more than a single value anyway.
-  const std::vector<bool>& null_values() const;
+  const Bitmap& null_values() const;
 
   // Returns the calculated memory usage.
   size_t estimate_memory_usage() const final;
 
  protected:
-  std::vector<T> _values;
-  std::vector<bool> _null_values;
+  StableVector<StoredType> _values;
+  // Only used by ValueSegment<std::string>.
+  StringArena _arena;
+  Bitmap _null_values;
   bool _is_nullable;
 };
 
@@ -0,0 +1,133 @@
+#include "zone_map.hpp"
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename Zone, typename T>
+void add_to_zone(Zone& zone, const T* value) {
+  ++zone.row_count;
+  if (!value) {
+    ++zone.null_count;
+    return;
+  }
+
+  if (zone.row_count - zone.null_count == 1) {
+    zone.min = *value;
+    zone.max = *value;
+  } else if (*value < zone.min) {
+    zone.min = *value;
+  } else if (zone.max < *value) {
+    zone.max = *value;
+  }
+}
+
+}  // namespace
+
+template <typename T>
+ZoneMap<T>::ZoneMap(const ChunkOffset block_size) : _block_size{block_size} {}
+
+template <typename T>
+void ZoneMap<T>::append(const std::optional<T>& value) {
+  _append(value ? &*value : nullptr);
+}
+
+template <typename T>
+void ZoneMap<T>::append(const std::span<const T> values, const Bitmap* null_values, const size_t null_offset) {
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    _append(null_values && (*null_values)[null_offset + index] ? nullptr : &values[index]);
+  }
+}
+
+template <typename T>
+void ZoneMap<T>::_append(const T* value) {
+  add_to_zone(_zone, value);
+
+  if (_block_size == 0) {
+    return;
+  }
+  if (_block_zones.empty() || _block_zones.back().row_count == _block_size) {
+    _block_zones.emplace_back();
+  }
+  add_to_zone(_block_zones.back(), value);
+}
+
+template <typename T>
+ZoneMatch ZoneMap<T>::match(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  // Comparisons with NULL never evaluate to true.
+  if (variant_is_null(search_value)) {
+    return ZoneMatch::None;
+  }
+  return match(_zone, scan_type, type_cast<T>(search_value));
+}
+
+template <typename T>
+ZoneMatch ZoneMap<T>::match(const Zone& zone, const ScanType scan_type, const T& search_value) {
+  if (zone.null_count == zone.row_count) {
+    return ZoneMatch::None;
+  }
+
+  // If the predicate holds for all non-NULL values, it holds for all rows only if there are no NULL values.
+  const auto all_or_some = [&](const bool all_values_qualify) {
+    return all_values_qualify && zone.null_count == 0 ? ZoneMatch::All : ZoneMatch::Some;
+  };
+  const auto& min = zone.min;
+  const auto& max = zone.max;
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      if (search_value < min || max < search_value) {
+        return ZoneMatch::None;
+      }
+      return all_or_some(min == search_value && max == search_value);
+    case ScanType::OpNotEquals:
+      if (min == search_value && max == search_value) {
+        return ZoneMatch::None;
+      }
+      return all_or_some(search_value < min || max < search_value);
+    case ScanType::OpLessThan:
+      if (!(min < search_value)) {
+        return ZoneMatch::None;
+      }
+      return all_or_some(max < search_value);
+    case ScanType::OpLessThanEquals:
+      if (search_value < min) {
+        return ZoneMatch::None;
+      }
+      return all_or_some(!(search_value < max));
+    case ScanType::OpGreaterThan:
+      if (!(search_value < max)) {
+        return ZoneMatch::None;
+      }
+      return all_or_some(search_value < min);
+    case ScanType::OpGreaterThanEquals:
+      if (max < search_value) {
+        return ZoneMatch::None;
+      }
+      return all_or_some(!(min < search_value));
+    default:
+      Fail("Invalid Scan type.");
+  }
+}
+
+template <typename T>
+const typename ZoneMap<T>::Zone& ZoneMap<T>::zone() const {
+  return _zone;
+}
+
+template <typename T>
+const std::vector<typename ZoneMap<T>::Zone>& ZoneMap<T>::block_zones() const {
+  return _block_zones;
+}
+
+template <typename T>
+ChunkOffset ZoneMap<T>::block_size() const {
+  return _block_size;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
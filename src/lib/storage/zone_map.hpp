@@ -0,0 +1,80 @@
+#pragma once
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "bitmap.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Whether none, some, or all rows of a zone satisfy a predicate.
+enum class ZoneMatch { None, Some, All };
+
+// A zone map keeps the minimum, the maximum, and the number of NULL values of a segment, which allows scans to skip
+// segments that cannot contain qualifying rows. Optionally, the same statistics are kept for each block of block_size
+// rows within the segment. Zone maps are maintained by the chunk when rows are appended (see Chunk::append) and are
+// carried over when a chunk is encoded.
+class AbstractZoneMap : private Noncopyable {
+ public:
+  // Number of rows per block that Table::use_block_zone_maps uses by default.
+  static constexpr auto DEFAULT_BLOCK_SIZE = ChunkOffset{2048};
+
+  virtual ~AbstractZoneMap() = default;
+
+  // Returns whether none, some, or all rows of the segment satisfy `value <scan_type> search_value`. NULL values never
+  // qualify.
+  virtual ZoneMatch match(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns the number of rows per block or 0 if no block statistics are kept.
+  virtual ChunkOffset block_size() const = 0;
+};
+
+template <typename T>
+class ZoneMap : public AbstractZoneMap {
+ public:
+  // Statistics about a range of rows. min and max are only meaningful if the range contains non-NULL values.
+  struct Zone {
+    T min{};
+    T max{};
+    ChunkOffset row_count{0};
+    ChunkOffset null_count{0};
+  };
+
+  // Creates an empty zone map. If block_size is not 0, statistics are also kept for each block of block_size rows.
+  explicit ZoneMap(const ChunkOffset block_size = 0);
+
+  // Adds the statistics of a value (std::nullopt for NULL) that was appended to the segment. Not thread-safe.
+  void append(const std::optional<T>& value);
+
+  // Same as append above, but for several values. If null_values is given, values[i] is NULL if the bit
+  // null_offset + i is set.
+  void append(const std::span<const T> values, const Bitmap* null_values = nullptr, const size_t null_offset = 0);
+
+  ZoneMatch match(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  // Returns whether none, some, or all rows of the zone satisfy `value <scan_type> search_value`.
+  static ZoneMatch match(const Zone& zone, const ScanType scan_type, const T& search_value);
+
+  // Returns the statistics of the whole segment.
+  const Zone& zone() const;
+
+  // Returns the statistics of the blocks. Block i covers the rows [i * block_size, (i + 1) * block_size).
+  const std::vector<Zone>& block_zones() const;
+
+  ChunkOffset block_size() const final;
+
+ protected:
+  // Adds a value, which is NULL if value is nullptr.
+  void _append(const T* value);
+
+  Zone _zone;
+  std::vector<Zone> _block_zones;
+  ChunkOffset _block_size;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
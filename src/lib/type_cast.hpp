@@ -6,6 +6,7 @@
 #include <boost/hana/size.hpp>
 #include <boost/hana/take_while.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/numeric/conversion/cast.hpp>
 
 #include "all_type_variant.hpp"
 
@@ -31,30 +32,64 @@ const T& get(const AllTypeVariant& value) {
   return boost::get<T>(value);
 }
 
-// cast methods - from variant to specific type
+namespace detail {
 
-// Template specialization for everything but integral types
 template <typename T>
-std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (static_cast<size_t>(value.which()) == detail::index_of(types_including_null, hana::type_c<T>)) {
-    return get<T>(value);
-  }
+constexpr auto is_number_v = std::is_arithmetic_v<T> || std::is_same_v<T, Decimal>;
 
-  return boost::lexical_cast<T>(value);
+// Converts a value held by an AllTypeVariant into T. Strings (and NULL) are converted by boost::lexical_cast, numbers
+// by boost::numeric_cast, which throws if the value does not fit into T.
+template <typename T, typename U>
+T convert(const U& value) {
+  if constexpr (std::is_same_v<T, U>) {
+    return value;
+  } else if constexpr (std::is_integral_v<U> && sizeof(U) == 1) {
+    // int8_t is a character type for streams and thus for boost::lexical_cast, e.g., it would be written as '\x05'.
+    return convert<T>(static_cast<int32_t>(value));
+  } else if constexpr (std::is_integral_v<T> && sizeof(T) == 1) {
+    return boost::numeric_cast<T>(convert<int32_t>(value));
+  } else if constexpr (std::is_same_v<U, Decimal> && is_number_v<T>) {
+    if constexpr (std::is_integral_v<T>) {
+      return boost::numeric_cast<T>(value.to_integer());
+    } else {
+      return static_cast<T>(value.to_double());
+    }
+  } else if constexpr (std::is_same_v<T, Decimal> && is_number_v<U>) {
+    if constexpr (std::is_integral_v<U>) {
+      return Decimal::from_integer(value);
+    } else {
+      return Decimal::from_double(value);
+    }
+  } else if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<U>) {
+    return boost::numeric_cast<T>(value);
+  } else if constexpr (std::is_same_v<T, Date> && std::is_same_v<U, Timestamp>) {
+    return value.date();
+  } else if constexpr (std::is_same_v<T, Timestamp> && std::is_same_v<U, Date>) {
+    return Timestamp{value};
+  } else if constexpr (std::is_integral_v<T>) {
+    // Strings like "1.5" cannot be read as integers directly.
+    try {
+      return boost::lexical_cast<T>(value);
+    } catch (...) {
+      return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
+    }
+  } else {
+    return boost::lexical_cast<T>(value);
+  }
 }
 
-// Template specialization for integral types
+}  // namespace detail
+
+// cast methods - from variant to specific type
+
+// Converts the value of an AllTypeVariant into T. Throws if the value cannot be converted.
 template <typename T>
-std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
+T type_cast(const AllTypeVariant& value) {
   if (static_cast<size_t>(value.which()) == detail::index_of(types_including_null, hana::type_c<T>)) {
     return get<T>(value);
   }
 
-  try {
-    return boost::lexical_cast<T>(value);
-  } catch (...) {
-    return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
-  }
+  return boost::apply_visitor([](const auto& held_value) { return detail::convert<T>(held_value); }, value);
 }
 
 }  // namespace opossum
@@ -32,12 +32,21 @@ STRONG_TYPEDEF(uint32_t, ChunkID);
 STRONG_TYPEDEF(uint16_t, ColumnID);
 STRONG_TYPEDEF(opossum::ColumnID::base_type, ColumnCount);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
+STRONG_TYPEDEF(uint16_t, PartitionID);
 
 namespace opossum {
 
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+// Commit ids order the commits of transactions. A snapshot (commit id) contains all rows that were committed at or
+// before it. Transaction ids identify the transaction that holds a row, i.e., inserts or deletes it.
+using CommitID = uint32_t;
+using TransactionID = uint32_t;
+
+constexpr CommitID MAX_COMMIT_ID{std::numeric_limits<CommitID>::max()};
+constexpr TransactionID INVALID_TRANSACTION_ID{0};
+
 constexpr ChunkOffset INVALID_CHUNK_OFFSET{std::numeric_limits<ChunkOffset>::max()};
 constexpr ChunkID INVALID_CHUNK_ID{std::numeric_limits<ChunkID::base_type>::max()};
 
@@ -73,6 +82,27 @@ enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGre
 
 using PosList = std::vector<RowID>;
 
+// Determines how DictionarySegments store their attribute vector: FixedWidthInteger uses one, two, or four bytes per
+// value id, BitPacking uses exactly as many bits as the biggest value id needs.
+enum class VectorCompressionType { FixedWidthInteger, BitPacking };
+
+// Segment types that Table::compress_chunk can create from ValueSegments. LZ can also be created from
+// DictionarySegments, e.g., to move already compressed chunks into cold storage.
+enum class EncodingType { Dictionary, RunLength, FrameOfReference, Delta, Gorilla, LZ };
+
+// Describes how a single segment is compressed. The vector compression type is only used by encodings that store
+// attribute vectors.
+struct SegmentEncodingSpec {
+  EncodingType encoding_type{EncodingType::Dictionary};
+  VectorCompressionType vector_compression_type{VectorCompressionType::FixedWidthInteger};
+};
+
+// What the EncodingAdvisor optimizes for when it chooses segment encodings.
+enum class EncodingGoal { MinimumMemory, FastestScan, Balanced };
+
+// Order of the values of a sorted segment. NULL values are either all before or all after the other values.
+enum class SortMode { AscendingNullsFirst, AscendingNullsLast, DescendingNullsFirst, DescendingNullsLast };
+
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
  protected:
@@ -2,10 +2,10 @@
 
 #include <fstream>
 
-#include <boost/lexical_cast.hpp>
-
 #include "resolve_type.hpp"
+#include "storage/column_batch.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
 #include "utils/assert.hpp"
 
 namespace {
@@ -22,6 +22,40 @@ std::vector<std::string> split(const std::string& str, char delimiter) {
   return result;
 }
 
+// The number of rows that are parsed before they are appended to the table.
+constexpr auto BATCH_SIZE = size_t{65'536};
+
+class AbstractColumnBuffer {
+ public:
+  virtual ~AbstractColumnBuffer() = default;
+
+  virtual void append(const std::string& string_value) = 0;
+
+  // Returns a column batch of the buffered values, which is valid until the buffer is cleared.
+  virtual std::shared_ptr<const opossum::AbstractColumnBatch> batch() const = 0;
+
+  virtual void clear() = 0;
+};
+
+template <typename T>
+class ColumnBuffer : public AbstractColumnBuffer {
+ public:
+  void append(const std::string& string_value) final {
+    _values.emplace_back(opossum::type_cast<T>(opossum::AllTypeVariant{string_value}));
+  }
+
+  std::shared_ptr<const opossum::AbstractColumnBatch> batch() const final {
+    return std::make_shared<opossum::ColumnBatch<T>>(std::span<const T>{_values});
+  }
+
+  void clear() final {
+    _values.clear();
+  }
+
+ protected:
+  std::vector<T> _values;
+};
+
 }  // namespace
 
 namespace opossum {
@@ -43,20 +77,44 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
     table->add_column(column_names[column_id], column_types[column_id], false);
   }
 
+  // Parse the values into typed columns and append them batch by batch, which avoids a variant per value.
+  auto column_buffers = std::vector<std::unique_ptr<AbstractColumnBuffer>>{};
+  column_buffers.reserve(column_count);
+  for (const auto& column_type : column_types) {
+    resolve_data_type(column_type, [&](auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      column_buffers.emplace_back(std::make_unique<ColumnBuffer<ColumnDataType>>());
+    });
+  }
+
+  const auto append_buffered_rows = [&]() {
+    auto column_batches = std::vector<std::shared_ptr<const AbstractColumnBatch>>{};
+    column_batches.reserve(column_count);
+    for (const auto& column_buffer : column_buffers) {
+      column_batches.emplace_back(column_buffer->batch());
+    }
+    table->append_columns(column_batches);
+    for (const auto& column_buffer : column_buffers) {
+      column_buffer->clear();
+    }
+  };
+
+  auto buffered_row_count = size_t{0};
   while (std::getline(infile, line)) {
     const auto string_values = split(line, '|');
     Assert(string_values.size() == column_count, "Mismatching number of values.");
-    auto variant_values = std::vector<AllTypeVariant>{};
-    variant_values.reserve(column_count);
-
     for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-      resolve_data_type(column_types[column_id], [&](auto data_type_t) {
-        using ColumnDataType = typename decltype(data_type_t)::type;
-        variant_values.emplace_back(boost::lexical_cast<ColumnDataType>(string_values[column_id]));
-      });
+      column_buffers[column_id]->append(string_values[column_id]);
     }
 
-    table->append(variant_values);
+    ++buffered_row_count;
+    if (buffered_row_count == BATCH_SIZE) {
+      append_buffered_rows();
+      buffered_row_count = 0;
+    }
+  }
+  if (buffered_row_count > 0) {
+    append_buffered_rows();
   }
   return table;
 }
@@ -0,0 +1,156 @@
+#include "lz_compression.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto MIN_MATCH_LENGTH = size_t{4};
+constexpr auto MAX_OFFSET = size_t{65535};
+// Matches are not started in the last bytes of the input, which keeps the compressor free of bounds checks.
+constexpr auto MATCH_SEARCH_END_MARGIN = size_t{12};
+constexpr auto HASH_BITS = 12;
+
+uint32_t read_uint32(const char* position) {
+  auto value = uint32_t{0};
+  std::memcpy(&value, position, sizeof(value));
+  return value;
+}
+
+uint32_t hash_sequence(const uint32_t sequence) {
+  // Multiplicative hashing with Knuth's constant, keeping the top bits.
+  return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+void write_length_extension(std::vector<char>& output, size_t length) {
+  while (length >= 255) {
+    output.push_back(static_cast<char>(255));
+    length -= 255;
+  }
+  output.push_back(static_cast<char>(length));
+}
+
+void write_sequence(std::vector<char>& output, const char* literals, const size_t literal_length,
+                    const size_t match_offset, const size_t match_length) {
+  const auto literal_nibble = std::min(literal_length, size_t{15});
+  const auto match_nibble = match_length == 0 ? size_t{0} : std::min(match_length - MIN_MATCH_LENGTH, size_t{15});
+  output.push_back(static_cast<char>((literal_nibble << 4) | match_nibble));
+
+  if (literal_nibble == 15) {
+    write_length_extension(output, literal_length - 15);
+  }
+  output.insert(output.end(), literals, literals + literal_length);
+
+  if (match_length == 0) {
+    return;
+  }
+  output.push_back(static_cast<char>(match_offset & 0xFF));
+  output.push_back(static_cast<char>(match_offset >> 8));
+  if (match_nibble == 15) {
+    write_length_extension(output, match_length - MIN_MATCH_LENGTH - 15);
+  }
+}
+
+size_t read_length_extension(std::span<const char> compressed, size_t& position) {
+  auto length = size_t{0};
+  auto byte = uint8_t{255};
+  while (byte == 255) {
+    Assert(position < compressed.size(), "Corrupt LZ block: length extends beyond the input.");
+    byte = static_cast<uint8_t>(compressed[position++]);
+    length += byte;
+  }
+  return length;
+}
+
+}  // namespace
+
+std::vector<char> lz_compress(std::span<const char> input) {
+  auto output = std::vector<char>{};
+  output.reserve(input.size() / 2 + 16);
+
+  const auto input_size = input.size();
+  const auto* const data = input.data();
+  auto hash_table = std::array<size_t, size_t{1} << HASH_BITS>{};
+  hash_table.fill(std::numeric_limits<size_t>::max());
+
+  auto literal_begin = size_t{0};
+  auto position = size_t{0};
+  while (input_size >= MATCH_SEARCH_END_MARGIN && position < input_size - MATCH_SEARCH_END_MARGIN) {
+    const auto sequence = read_uint32(data + position);
+    const auto hash = hash_sequence(sequence);
+    const auto candidate = hash_table[hash];
+    hash_table[hash] = position;
+
+    if (candidate == std::numeric_limits<size_t>::max() || position - candidate > MAX_OFFSET ||
+        read_uint32(data + candidate) != sequence) {
+      ++position;
+      continue;
+    }
+
+    auto match_length = MIN_MATCH_LENGTH;
+    while (position + match_length < input_size && data[candidate + match_length] == data[position + match_length]) {
+      ++match_length;
+    }
+
+    write_sequence(output, data + literal_begin, position - literal_begin, position - candidate, match_length);
+    position += match_length;
+    literal_begin = position;
+  }
+
+  write_sequence(output, data + literal_begin, input_size - literal_begin, 0, 0);
+  return output;
+}
+
+void lz_decompress(std::span<const char> compressed, std::span<char> output) {
+  auto input_position = size_t{0};
+  auto output_position = size_t{0};
+
+  while (input_position < compressed.size()) {
+    const auto token = static_cast<uint8_t>(compressed[input_position++]);
+
+    auto literal_length = static_cast<size_t>(token >> 4);
+    if (literal_length == 15) {
+      literal_length += read_length_extension(compressed, input_position);
+    }
+    Assert(input_position + literal_length <= compressed.size() && output_position + literal_length <= output.size(),
+           "Corrupt LZ block: literals exceed the input or output.");
+    std::memcpy(output.data() + output_position, compressed.data() + input_position, literal_length);
+    input_position += literal_length;
+    output_position += literal_length;
+
+    // The last sequence only consists of literals.
+    if (input_position == compressed.size()) {
+      break;
+    }
+
+    Assert(input_position + 2 <= compressed.size(), "Corrupt LZ block: missing match offset.");
+    const auto offset = static_cast<size_t>(static_cast<uint8_t>(compressed[input_position])) |
+                        (static_cast<size_t>(static_cast<uint8_t>(compressed[input_position + 1])) << 8);
+    input_position += 2;
+
+    auto match_length = static_cast<size_t>(token & 0x0F);
+    if (match_length == 15) {
+      match_length += read_length_extension(compressed, input_position);
+    }
+    match_length += MIN_MATCH_LENGTH;
+
+    Assert(offset > 0 && offset <= output_position && output_position + match_length <= output.size(),
+           "Corrupt LZ block: match exceeds the output.");
+    // Matches may overlap with the bytes they produce (e.g., for runs), so they are copied byte by byte.
+    for (auto index = size_t{0}; index < match_length; ++index) {
+      output[output_position + index] = output[output_position - offset + index];
+    }
+    output_position += match_length;
+  }
+
+  Assert(output_position == output.size(), "Corrupt LZ block: decompressed size does not match.");
+}
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+namespace opossum {
+
+// A byte-oriented LZ77 codec following the LZ4 block format: a compressed block is a sequence of (token, literals,
+// match) triples. The token's high nibble holds the literal length, its low nibble the match length minus 4; values of
+// 15 are extended by additional bytes that are added until one is smaller than 255. Matches are encoded as a two-byte
+// little-endian offset into the already decoded output. The last sequence only consists of literals.
+//
+// The codec favors decompression speed over compression ratio and is intended for rarely accessed data.
+
+// Compresses the given bytes.
+std::vector<char> lz_compress(std::span<const char> input);
+
+// Decompresses the given block into output, which has to have exactly the size of the uncompressed data.
+void lz_decompress(std::span<const char> compressed, std::span<char> output);
+
+}  // namespace opossum
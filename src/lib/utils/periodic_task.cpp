@@ -0,0 +1,33 @@
+#include "periodic_task.hpp"
+
+#include <utility>
+
+namespace opossum {
+
+PeriodicTask::PeriodicTask(const std::chrono::milliseconds interval, std::function<void()> function)
+    : _interval{interval}, _function{std::move(function)} {
+  _thread = std::thread([this]() {
+    auto lock = std::unique_lock{_stop_mutex};
+    while (!_stop_condition.wait_for(lock, _interval, [this]() { return _stop; })) {
+      lock.unlock();
+      run_now();
+      lock.lock();
+    }
+  });
+}
+
+PeriodicTask::~PeriodicTask() {
+  {
+    const auto lock = std::lock_guard{_stop_mutex};
+    _stop = true;
+  }
+  _stop_condition.notify_one();
+  _thread.join();
+}
+
+void PeriodicTask::run_now() {
+  const auto lock = std::lock_guard{_run_mutex};
+  _function();
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// PeriodicTask runs the given function in a background thread each time the interval elapses, e.g., for the
+// maintenance of a table (see DeltaMerger and ChunkCompactor). The thread is stopped when the task is destroyed. A run
+// that is in progress is finished first.
+class PeriodicTask : private Noncopyable {
+ public:
+  PeriodicTask(const std::chrono::milliseconds interval, std::function<void()> function);
+
+  ~PeriodicTask();
+
+  // Runs the function right away instead of waiting for the interval to elapse. Blocks until the run is done.
+  void run_now();
+
+ protected:
+  std::chrono::milliseconds _interval;
+  std::function<void()> _function;
+
+  // Serializes the runs of the background thread and run_now.
+  std::mutex _run_mutex;
+  std::mutex _stop_mutex;
+  std::condition_variable _stop_condition;
+  bool _stop{false};
+  std::thread _thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,149 @@
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "storage/mvcc_data.hpp"
+
+namespace opossum {
+
+class ConcurrencyTransactionContextTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table.add_column("a", "int", false);
+  }
+
+  // Returns whether the row of the first chunk is visible to the transaction.
+  bool is_visible(const TransactionContext& transaction_context, const ChunkOffset chunk_offset) const {
+    return transaction_context.is_visible(*table.get_chunk(ChunkID{0})->mvcc_data(), chunk_offset);
+  }
+
+  Table table{10};
+};
+
+TEST_F(ConcurrencyTransactionContextTest, SnapshotIsolation) {
+  auto& transaction_manager = TransactionManager::get();
+  table.append({1});
+  const auto reader = transaction_manager.new_transaction_context();
+  EXPECT_EQ(reader->snapshot_commit_id(), transaction_manager.last_commit_id());
+
+  // Rows committed after the snapshot are not visible.
+  table.append({2});
+  EXPECT_TRUE(is_visible(*reader, 0));
+  EXPECT_FALSE(is_visible(*reader, 1));
+
+  // Rows inserted by a transaction are only visible to others after it committed.
+  const auto writer = transaction_manager.new_transaction_context();
+  EXPECT_NE(writer->transaction_id(), reader->transaction_id());
+  table.append({3}, *writer);
+  EXPECT_TRUE(is_visible(*writer, 1));
+  EXPECT_TRUE(is_visible(*writer, 2));
+  EXPECT_FALSE(is_visible(*reader, 2));
+  EXPECT_FALSE(is_visible(*transaction_manager.new_transaction_context(), 2));
+
+  EXPECT_EQ(writer->phase(), TransactionPhase::Active);
+  writer->commit();
+  EXPECT_EQ(writer->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(writer->commit_id(), transaction_manager.last_commit_id());
+  EXPECT_FALSE(is_visible(*reader, 2));
+  EXPECT_TRUE(is_visible(*transaction_manager.new_transaction_context(), 2));
+
+  EXPECT_THROW(writer->commit(), std::logic_error);
+  EXPECT_THROW(table.append({4}, *writer), std::logic_error);
+}
+
+TEST_F(ConcurrencyTransactionContextTest, Rollback) {
+  auto& transaction_manager = TransactionManager::get();
+  {
+    const auto writer = transaction_manager.new_transaction_context();
+    table.append({1}, *writer);
+    writer->rollback();
+    EXPECT_EQ(writer->phase(), TransactionPhase::RolledBack);
+    EXPECT_FALSE(writer->commit_id());
+    EXPECT_THROW(writer->rollback(), std::logic_error);
+
+    // Active transactions are rolled back when their context is destroyed.
+    const auto abandoned_writer = transaction_manager.new_transaction_context();
+    table.append({2}, *abandoned_writer);
+  }
+
+  const auto reader = transaction_manager.new_transaction_context();
+  EXPECT_EQ(table.row_count(), 2);
+  EXPECT_FALSE(is_visible(*reader, 0));
+  EXPECT_FALSE(is_visible(*reader, 1));
+}
+
+TEST_F(ConcurrencyTransactionContextTest, TryDelete) {
+  auto& transaction_manager = TransactionManager::get();
+  table.append({1});
+  table.append({2});
+  const auto mvcc_data = table.get_chunk(ChunkID{0})->mvcc_data();
+  const auto reader = transaction_manager.new_transaction_context();
+  EXPECT_EQ(transaction_manager.lowest_active_snapshot_commit_id(), reader->snapshot_commit_id());
+
+  // Deleted rows remain visible to others until the delete is committed.
+  const auto deleter = transaction_manager.new_transaction_context();
+  EXPECT_TRUE(deleter->try_delete(mvcc_data, 0));
+  EXPECT_TRUE(deleter->try_delete(mvcc_data, 0));
+  EXPECT_FALSE(is_visible(*deleter, 0));
+  EXPECT_TRUE(is_visible(*reader, 0));
+  EXPECT_FALSE(mvcc_data->is_invalidated(0));
+
+  // Only one transaction can delete a row.
+  const auto other_deleter = transaction_manager.new_transaction_context();
+  EXPECT_FALSE(other_deleter->try_delete(mvcc_data, 0));
+  EXPECT_TRUE(other_deleter->has_conflict());
+  EXPECT_THROW(other_deleter->commit(), std::logic_error);
+  other_deleter->rollback();
+
+  deleter->commit();
+  EXPECT_TRUE(mvcc_data->is_invalidated(0));
+  EXPECT_EQ(mvcc_data->invalidated_row_count(), 1);
+  EXPECT_TRUE(is_visible(*reader, 0));
+  EXPECT_FALSE(is_visible(*transaction_manager.new_transaction_context(), 0));
+
+  // Rows deleted after the snapshot cannot be deleted anymore.
+  EXPECT_FALSE(reader->try_delete(mvcc_data, 0));
+  reader->rollback();
+
+  // A rolled back delete releases the row.
+  {
+    const auto rolled_back_deleter = transaction_manager.new_transaction_context();
+    EXPECT_TRUE(rolled_back_deleter->try_delete(mvcc_data, 1));
+  }
+  EXPECT_FALSE(mvcc_data->is_invalidated(1));
+  EXPECT_TRUE(is_visible(*transaction_manager.new_transaction_context(), 1));
+
+  // Rows inserted by the transaction itself can be deleted, too. Rolled back inserts are invalidated.
+  const auto writer = transaction_manager.new_transaction_context();
+  table.append({3}, *writer);
+  table.append({4}, *writer);
+  EXPECT_TRUE(writer->try_delete(mvcc_data, 2));
+  EXPECT_FALSE(is_visible(*writer, 2));
+  EXPECT_TRUE(is_visible(*writer, 3));
+  writer->commit();
+  EXPECT_FALSE(is_visible(*transaction_manager.new_transaction_context(), 2));
+  EXPECT_TRUE(is_visible(*transaction_manager.new_transaction_context(), 3));
+
+  const auto rolled_back_writer = transaction_manager.new_transaction_context();
+  table.append({5}, *rolled_back_writer);
+  rolled_back_writer->rollback();
+  EXPECT_TRUE(mvcc_data->is_invalidated(4));
+  EXPECT_EQ(table.approx_valid_row_count(), 2);
+}
+
+TEST_F(ConcurrencyTransactionContextTest, ActiveSnapshots) {
+  auto& transaction_manager = TransactionManager::get();
+  table.append({1});
+  const auto reader = transaction_manager.new_transaction_context();
+  const auto other_reader = transaction_manager.new_transaction_context();
+  EXPECT_EQ(reader->snapshot_commit_id(), other_reader->snapshot_commit_id());
+  table.append({2});
+
+  // Each transaction only removes its own registration, even if others read the same snapshot.
+  other_reader->commit();
+  EXPECT_EQ(transaction_manager.lowest_active_snapshot_commit_id(), reader->snapshot_commit_id());
+  reader->rollback();
+  EXPECT_EQ(transaction_manager.lowest_active_snapshot_commit_id(), transaction_manager.last_commit_id());
+}
+
+}  // namespace opossum
@@ -5,7 +5,8 @@ namespace opossum {
 template <typename T>
 class AllTypeVariantTest : public BaseTest {};
 
-using AllTypeVariantTestDataTypes = ::testing::Types<int32_t, int64_t, float, double, std::string, NullValue>;
+using AllTypeVariantTestDataTypes = ::testing::Types<int32_t, int64_t, float, double, std::string, int8_t, int16_t,
+                                                     Date, Timestamp, Decimal, NullValue>;
 TYPED_TEST_SUITE(AllTypeVariantTest, AllTypeVariantTestDataTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(AllTypeVariantTest, GetExtractsExactValue) {
@@ -16,6 +17,14 @@ TYPED_TEST(AllTypeVariantTest, GetExtractsExactValue) {
     values.emplace_back(std::string{"reallyreallylongstringthatcantbestoredusingsso"});
   } else if constexpr (std::is_same_v<TypeParam, NullValue>) {
     values.emplace_back(NullValue{});
+  } else if constexpr (std::is_same_v<TypeParam, Decimal>) {
+    values.emplace_back(Decimal::from_unscaled(std::numeric_limits<int64_t>::min()));
+    values.emplace_back(Decimal::from_unscaled(std::numeric_limits<int64_t>::max()));
+    values.emplace_back(Decimal::from_unscaled(-12'345));
+  } else if constexpr (!std::is_arithmetic_v<TypeParam>) {
+    values.emplace_back(TypeParam{-1});
+    values.emplace_back(TypeParam{0});
+    values.emplace_back(TypeParam{19'000});
   } else {
     values.emplace_back(std::numeric_limits<TypeParam>::min());
     values.emplace_back(std::numeric_limits<TypeParam>::lowest());
@@ -0,0 +1,72 @@
+#include "base_test.hpp"
+
+#include "date_time.hpp"
+
+namespace opossum {
+
+class DateTimeTest : public BaseTest {};
+
+TEST_F(DateTimeTest, DateFromYearMonthDay) {
+  EXPECT_EQ(Date::from_year_month_day(1970, 1, 1).days_since_epoch(), 0);
+  EXPECT_EQ(Date::from_year_month_day(1970, 2, 1).days_since_epoch(), 31);
+  EXPECT_EQ(Date::from_year_month_day(1969, 12, 31).days_since_epoch(), -1);
+  EXPECT_EQ(Date::from_year_month_day(2000, 2, 29).days_since_epoch(), 11'016);
+
+  const auto year_month_day = Date{11'016}.year_month_day();
+  EXPECT_EQ(static_cast<int32_t>(year_month_day.year()), 2000);
+  EXPECT_EQ(static_cast<uint32_t>(year_month_day.month()), 2);
+  EXPECT_EQ(static_cast<uint32_t>(year_month_day.day()), 29);
+
+  EXPECT_THROW(Date::from_year_month_day(2001, 2, 29), std::logic_error);
+  EXPECT_THROW(Date::from_year_month_day(2000, 13, 1), std::logic_error);
+}
+
+TEST_F(DateTimeTest, ParseAndPrintDate) {
+  EXPECT_EQ(Date::parse("1970-01-01"), Date{0});
+  EXPECT_EQ(Date::parse("2023-06-15"), Date::from_year_month_day(2023, 6, 15));
+  EXPECT_EQ(Date::parse("1900-03-01"), Date::from_year_month_day(1900, 3, 1));
+
+  auto stream = std::stringstream{};
+  stream << Date::from_year_month_day(2023, 6, 5) << " " << Date::from_year_month_day(812, 12, 25);
+  EXPECT_EQ(stream.str(), "2023-06-05 0812-12-25");
+
+  EXPECT_THROW(Date::parse(""), std::logic_error);
+  EXPECT_THROW(Date::parse("2023-6-15"), std::logic_error);
+  EXPECT_THROW(Date::parse("2023-02-30"), std::logic_error);
+  EXPECT_THROW(Date::parse("2023-06-15x"), std::logic_error);
+}
+
+TEST_F(DateTimeTest, ParseAndPrintTimestamp) {
+  const auto date = Date::from_year_month_day(2023, 6, 15);
+  const auto midnight = Timestamp{date};
+  EXPECT_EQ(midnight.microseconds_since_epoch(), date.days_since_epoch() * Timestamp::MICROSECONDS_PER_DAY);
+
+  EXPECT_EQ(Timestamp::parse("2023-06-15"), midnight);
+  EXPECT_EQ(Timestamp::parse("2023-06-15 00:00:00"), midnight);
+  EXPECT_EQ(Timestamp::parse("2023-06-15 12:30:05"),
+            Timestamp{midnight.microseconds_since_epoch() + ((12 * 60 + 30) * 60 + 5) * int64_t{1'000'000}});
+  EXPECT_EQ(Timestamp::parse("2023-06-15 00:00:00.25"), Timestamp{midnight.microseconds_since_epoch() + 250'000});
+  EXPECT_EQ(Timestamp::parse("1969-12-31 23:59:59.999999"), Timestamp{-1});
+
+  auto stream = std::stringstream{};
+  stream << Timestamp::parse("2023-06-15 12:30:05") << "|" << Timestamp{-1};
+  EXPECT_EQ(stream.str(), "2023-06-15 12:30:05|1969-12-31 23:59:59.999999");
+
+  EXPECT_THROW(Timestamp::parse("2023-06-15 24:00:00"), std::logic_error);
+  EXPECT_THROW(Timestamp::parse("2023-06-15 12:30"), std::logic_error);
+  EXPECT_THROW(Timestamp::parse("2023-06-15 12:30:05.1234567"), std::logic_error);
+}
+
+TEST_F(DateTimeTest, TimestampDate) {
+  EXPECT_EQ(Timestamp::parse("2023-06-15 23:59:59").date(), Date::parse("2023-06-15"));
+  EXPECT_EQ(Timestamp{-1}.date(), Date{-1});
+  EXPECT_EQ(Timestamp{0}.date(), Date{0});
+}
+
+TEST_F(DateTimeTest, Comparison) {
+  EXPECT_LT(Date::parse("1999-12-31"), Date::parse("2000-01-01"));
+  EXPECT_GT(Timestamp::parse("2000-01-01 00:00:01"), Timestamp::parse("2000-01-01"));
+  EXPECT_EQ(std::hash<Date>{}(Date{5}), std::hash<Date>{}(Date::parse("1970-01-06")));
+}
+
+}  // namespace opossum
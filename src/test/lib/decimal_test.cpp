@@ -0,0 +1,55 @@
+#include "base_test.hpp"
+
+#include "decimal.hpp"
+
+namespace opossum {
+
+class DecimalTest : public BaseTest {};
+
+TEST_F(DecimalTest, Construction) {
+  EXPECT_EQ(Decimal::from_integer(12).unscaled_value(), 120'000);
+  EXPECT_EQ(Decimal::from_integer(-3).unscaled_value(), -30'000);
+  EXPECT_EQ(Decimal::from_double(1.5).unscaled_value(), 15'000);
+  EXPECT_EQ(Decimal::from_double(0.00005).unscaled_value(), 1);
+  EXPECT_EQ(Decimal::from_double(-0.00005).unscaled_value(), -1);
+
+  EXPECT_THROW(Decimal::from_integer(std::numeric_limits<int64_t>::max()), std::logic_error);
+  EXPECT_THROW(Decimal::from_double(1e20), std::logic_error);
+}
+
+TEST_F(DecimalTest, Conversion) {
+  EXPECT_EQ(Decimal::from_unscaled(12'345).to_integer(), 1);
+  EXPECT_EQ(Decimal::from_unscaled(-12'345).to_integer(), -1);
+  EXPECT_DOUBLE_EQ(Decimal::from_unscaled(-12'345).to_double(), -1.2345);
+}
+
+TEST_F(DecimalTest, ParseAndPrint) {
+  EXPECT_EQ(Decimal::parse("0"), Decimal{});
+  EXPECT_EQ(Decimal::parse("12.3456"), Decimal::from_unscaled(123'456));
+  EXPECT_EQ(Decimal::parse("-0.5"), Decimal::from_unscaled(-5'000));
+  EXPECT_EQ(Decimal::parse("+7"), Decimal::from_integer(7));
+  EXPECT_EQ(Decimal::parse(".25"), Decimal::from_unscaled(2'500));
+  // Additional fractional digits are rounded half away from zero.
+  EXPECT_EQ(Decimal::parse("1.00005"), Decimal::from_unscaled(10'001));
+  EXPECT_EQ(Decimal::parse("-1.00005"), Decimal::from_unscaled(-10'001));
+  EXPECT_EQ(Decimal::parse("1.00004999"), Decimal::from_unscaled(10'000));
+
+  auto stream = std::stringstream{};
+  stream << Decimal::from_unscaled(123'456) << " " << Decimal::from_unscaled(-5'000) << " " << Decimal{} << " "
+         << Decimal::from_unscaled(std::numeric_limits<int64_t>::min());
+  EXPECT_EQ(stream.str(), "12.3456 -0.5000 0.0000 -922337203685477.5808");
+
+  EXPECT_THROW(Decimal::parse(""), std::logic_error);
+  EXPECT_THROW(Decimal::parse("-"), std::logic_error);
+  EXPECT_THROW(Decimal::parse("1.2.3"), std::logic_error);
+  EXPECT_THROW(Decimal::parse("1e3"), std::logic_error);
+  EXPECT_THROW(Decimal::parse("99999999999999999999"), std::logic_error);
+}
+
+TEST_F(DecimalTest, Comparison) {
+  EXPECT_LT(Decimal::parse("-1.5"), Decimal::parse("-1.4999"));
+  EXPECT_GT(Decimal::parse("0.0001"), Decimal{});
+  EXPECT_EQ(Decimal::parse("2.50"), Decimal::from_double(2.5));
+}
+
+}  // namespace opossum
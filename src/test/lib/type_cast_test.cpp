@@ -0,0 +1,62 @@
+#include "base_test.hpp"
+
+#include "type_cast.hpp"
+
+namespace opossum {
+
+class TypeCastTest : public BaseTest {};
+
+TEST_F(TypeCastTest, Numbers) {
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{int32_t{17}}), 17);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"17"}), 17);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"17.5"}), 17);
+  EXPECT_FLOAT_EQ(type_cast<float>(AllTypeVariant{"2.5"}), 2.5f);
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{int64_t{-3}}), "-3");
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"abc"}), boost::bad_lexical_cast);
+}
+
+TEST_F(TypeCastTest, NarrowIntegers) {
+  EXPECT_EQ(type_cast<int8_t>(AllTypeVariant{"5"}), int8_t{5});
+  EXPECT_EQ(type_cast<int8_t>(AllTypeVariant{"-128"}), int8_t{-128});
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{int8_t{5}}), "5");
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{int8_t{-5}}), -5);
+  EXPECT_EQ(type_cast<int16_t>(AllTypeVariant{int32_t{1'000}}), int16_t{1'000});
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{int16_t{-1'000}}), "-1000");
+
+  // Values that do not fit into the narrower type are rejected rather than wrapped around.
+  EXPECT_THROW(type_cast<int8_t>(AllTypeVariant{"128"}), boost::bad_numeric_cast);
+  EXPECT_THROW(type_cast<int8_t>(AllTypeVariant{int32_t{300}}), boost::bad_numeric_cast);
+  EXPECT_THROW(type_cast<int16_t>(AllTypeVariant{int64_t{40'000}}), boost::bad_numeric_cast);
+}
+
+TEST_F(TypeCastTest, DateAndTimestamp) {
+  const auto date = Date::from_year_month_day(2023, 6, 15);
+  EXPECT_EQ(type_cast<Date>(AllTypeVariant{"2023-06-15"}), date);
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{date}), "2023-06-15");
+  EXPECT_EQ(type_cast<Timestamp>(AllTypeVariant{"2023-06-15 08:00:00"}), Timestamp::parse("2023-06-15 08:00:00"));
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{Timestamp{date}}), "2023-06-15 00:00:00");
+
+  EXPECT_EQ(type_cast<Timestamp>(AllTypeVariant{date}), Timestamp{date});
+  EXPECT_EQ(type_cast<Date>(AllTypeVariant{Timestamp::parse("2023-06-15 08:00:00")}), date);
+
+  EXPECT_THROW(type_cast<Date>(AllTypeVariant{"2023-02-30"}), boost::bad_lexical_cast);
+  EXPECT_THROW(type_cast<Date>(AllTypeVariant{int32_t{5}}), boost::bad_lexical_cast);
+}
+
+TEST_F(TypeCastTest, Decimal) {
+  EXPECT_EQ(type_cast<Decimal>(AllTypeVariant{"12.5"}), Decimal::from_unscaled(125'000));
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{Decimal::from_unscaled(125'000)}), "12.5000");
+  EXPECT_EQ(type_cast<Decimal>(AllTypeVariant{int32_t{3}}), Decimal::from_integer(3));
+  EXPECT_EQ(type_cast<Decimal>(AllTypeVariant{2.25}), Decimal::from_unscaled(22'500));
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{Decimal::from_unscaled(125'000)}), 12);
+  EXPECT_DOUBLE_EQ(type_cast<double>(AllTypeVariant{Decimal::from_unscaled(125'000)}), 12.5);
+  EXPECT_THROW(type_cast<Decimal>(AllTypeVariant{"12.5x"}), boost::bad_lexical_cast);
+}
+
+TEST_F(TypeCastTest, Null) {
+  EXPECT_EQ(type_cast<std::string>(NULL_VALUE), "NULL");
+  EXPECT_THROW(type_cast<int32_t>(NULL_VALUE), boost::bad_lexical_cast);
+  EXPECT_THROW(type_cast<Date>(NULL_VALUE), boost::bad_lexical_cast);
+}
+
+}  // namespace opossum
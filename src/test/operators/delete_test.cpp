@@ -0,0 +1,117 @@
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class OperatorsDeleteTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "float", true);
+    for (auto index = int32_t{0}; index < 10; ++index) {
+      _table->append({index, index % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index * 1.5f}});
+    }
+    _table->compress_chunk(ChunkID{0});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  // Returns the scanned values of the first column, executed in the transaction if one is given.
+  static std::vector<AllTypeVariant> scan(const ScanType scan_type, const AllTypeVariant& search_value,
+                                          const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    const auto scan = scan_operator(scan_type, search_value, transaction_context);
+    auto values = std::vector<AllTypeVariant>{};
+    const auto segment = scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+      values.emplace_back((*segment)[chunk_offset]);
+    }
+    return values;
+  }
+
+  static std::shared_ptr<TableScan> scan_operator(
+      const ScanType scan_type, const AllTypeVariant& search_value,
+      const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    auto scan = std::make_shared<TableScan>(get_table, ColumnID{0}, scan_type, search_value);
+    scan->set_transaction_context(transaction_context);
+    scan->execute();
+    return scan;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsDeleteTest, DeleteWithoutTransaction) {
+  const auto reader = TransactionManager::get().new_transaction_context();
+  auto delete_operator =
+      std::make_shared<Delete>("table", scan_operator(ScanType::OpLessThan, 5));
+  EXPECT_EQ(delete_operator->table_name(), "table");
+  delete_operator->execute();
+  EXPECT_FALSE(delete_operator->execute_failed());
+  EXPECT_EQ(delete_operator->get_output()->get_chunk(ChunkID{0})->size(), 5);
+
+  // Scans outside of transactions skip the invalidated rows, running transactions still see them.
+  EXPECT_EQ(_table->row_count(), 10);
+  EXPECT_EQ(_table->approx_valid_row_count(), 5);
+  EXPECT_EQ(scan(ScanType::OpNotEquals, 7), (std::vector<AllTypeVariant>{5, 6, 8, 9}));
+  EXPECT_EQ(scan(ScanType::OpGreaterThan, 1, reader), (std::vector<AllTypeVariant>{2, 3, 4, 5, 6, 7, 8, 9}));
+  EXPECT_EQ(scan(ScanType::OpGreaterThan, 1, TransactionManager::get().new_transaction_context()),
+            (std::vector<AllTypeVariant>{5, 6, 7, 8, 9}));
+
+  // The input has to refer to the table.
+  auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  EXPECT_THROW(Delete("table", get_table).execute(), std::logic_error);
+}
+
+TEST_F(OperatorsDeleteTest, DeleteInTransaction) {
+  auto& transaction_manager = TransactionManager::get();
+  const auto transaction_context = transaction_manager.new_transaction_context();
+  auto delete_operator = std::make_shared<Delete>("table", scan_operator(ScanType::OpEquals, 4, transaction_context));
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+  EXPECT_FALSE(delete_operator->execute_failed());
+
+  EXPECT_EQ(scan(ScanType::OpLessThan, 6, transaction_context), (std::vector<AllTypeVariant>{0, 1, 2, 3, 5}));
+  EXPECT_EQ(scan(ScanType::OpLessThan, 6, transaction_manager.new_transaction_context()),
+            (std::vector<AllTypeVariant>{0, 1, 2, 3, 4, 5}));
+
+  // A concurrent delete of the same row fails and is rolled back.
+  auto conflicting_delete = std::make_shared<Delete>("table", scan_operator(ScanType::OpGreaterThan, 2));
+  conflicting_delete->execute();
+  EXPECT_TRUE(conflicting_delete->execute_failed());
+  EXPECT_EQ(_table->approx_valid_row_count(), 10);
+
+  transaction_context->commit();
+  EXPECT_EQ(scan(ScanType::OpLessThan, 6), (std::vector<AllTypeVariant>{0, 1, 2, 3, 5}));
+  EXPECT_EQ(_table->approx_valid_row_count(), 9);
+}
+
+TEST_F(OperatorsDeleteTest, SkipNullPositions) {
+  // NULL positions do not refer to rows and are skipped.
+  auto pos_list =
+      std::make_shared<PosList>(std::initializer_list<RowID>{NULL_ROW_ID, RowID{ChunkID{1}, ChunkOffset{2}}});
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list));
+  chunk->add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{1}, pos_list));
+  auto table_wrapper = std::make_shared<TableWrapper>(std::make_shared<Table>(*_table, std::move(chunk)));
+  table_wrapper->execute();
+
+  auto delete_operator = std::make_shared<Delete>("table", table_wrapper);
+  delete_operator->execute();
+  EXPECT_FALSE(delete_operator->execute_failed());
+  EXPECT_EQ(_table->approx_valid_row_count(), 9);
+  EXPECT_EQ(scan(ScanType::OpLessThan, 6), (std::vector<AllTypeVariant>{0, 1, 2, 3, 4}));
+}
+
+}  // namespace opossum
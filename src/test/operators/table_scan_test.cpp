@@ -1,5 +1,9 @@
 #include "base_test.hpp"
 
+#include <thread>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -306,4 +310,570 @@ TEST_F(OperatorsTableScanTest, ScanOnReferenceSegmentWithNullValue) {
     ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{1}, test.second);
   }
 }
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnWithNullValue) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", true);
+  table->append({1});
+  table->append({NULL_VALUE});
+  table->append({3});
+  table->compress_chunk(ChunkID{0});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {};
+  tests[ScanType::OpNotEquals] = {1, 3};
+  tests[ScanType::OpLessThan] = {1, 3};
+  tests[ScanType::OpLessThanEquals] = {1, 3};
+  tests[ScanType::OpGreaterThan] = {};
+  tests[ScanType::OpGreaterThanEquals] = {};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 5);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, test.second);
+
+    auto null_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, NULL_VALUE);
+    null_scan->execute();
+    EXPECT_EQ(null_scan->get_output()->row_count(), 0);
+  }
+}
+
+
+TEST_F(OperatorsTableScanTest, ScanOnGlobalDictionaryColumn) {
+  const auto table = std::make_shared<Table>(5);
+  table->add_column("a", "int", false);
+  table->add_column("b", "int", true);
+  for (auto index = int32_t{0}; index <= 24; index += 2) {
+    table->append({index % 10, 100 + index});
+  }
+  table->append({25, NULL_VALUE});
+  table->use_global_dictionary(ColumnID{0});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1});
+  table->compress_chunk(ChunkID{2});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {104, 114, 124};
+  tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 116, 118, 120, 122, NULL_VALUE};
+  tests[ScanType::OpLessThan] = {100, 102, 110, 112, 120, 122};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104, 110, 112, 114, 120, 122, 124};
+  tests[ScanType::OpGreaterThan] = {106, 108, 116, 118, NULL_VALUE};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 114, 116, 118, 124, NULL_VALUE};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 4);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+
+    // Executing the scan again must not reuse the bounds of another dictionary.
+    scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
+    scan->execute();
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnUnsortedDictionarySegment) {
+  const auto table = std::make_shared<Table>(5);
+  table->add_column("a", "int", false);
+  table->add_column("b", "int", true);
+  table->use_delta_store();
+  for (auto index = int32_t{24}; index >= 0; index -= 2) {
+    table->append({index, 100 + index});
+  }
+  table->append({25, NULL_VALUE});
+  table->merge_delta();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {124, 122, 120, 118, 116, 114, 112, 110, 108, 106, 102, 100, NULL_VALUE};
+  tests[ScanType::OpLessThan] = {102, 100};
+  tests[ScanType::OpLessThanEquals] = {104, 102, 100};
+  tests[ScanType::OpGreaterThan] = {124, 122, 120, 118, 116, 114, 112, 110, 108, 106, NULL_VALUE};
+  tests[ScanType::OpGreaterThanEquals] = {124, 122, 120, 118, 116, 114, 112, 110, 108, 106, 104, NULL_VALUE};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 4);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+
+    auto null_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, test.first, NULL_VALUE);
+    null_scan->execute();
+    EXPECT_EQ(null_scan->get_output()->row_count(), 0);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnRunLengthSegment) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int", true);
+  for (const auto value : {1, 1, 1, 2, 2, 3, 3, 3}) {
+    table->append({value});
+  }
+  table->append({NULL_VALUE});
+  table->append({1});
+  table->compress_chunk(ChunkID{0}, SegmentEncodingSpec{EncodingType::RunLength});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {2, 2};
+  tests[ScanType::OpNotEquals] = {1, 1, 1, 3, 3, 3, 1};
+  tests[ScanType::OpLessThan] = {1, 1, 1, 1};
+  tests[ScanType::OpLessThanEquals] = {1, 1, 1, 2, 2, 1};
+  tests[ScanType::OpGreaterThan] = {3, 3, 3};
+  tests[ScanType::OpGreaterThanEquals] = {2, 2, 3, 3, 3};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 2);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, test.second);
+  }
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  scan->execute();
+  const auto output_segment = scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(output_segment);
+  EXPECT_EQ(*reference_segment->pos_list(), (PosList{{ChunkID{0}, 5}, {ChunkID{0}, 6}, {ChunkID{0}, 7}}));
+}
+
+
+TEST_F(OperatorsTableScanTest, ScanOnFrameOfReferenceSegment) {
+  // Two blocks: the first one holds 0 to 2047, the second one 10000 to 10099 and a NULL value.
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "long", true);
+  for (auto value = int64_t{0}; value < 2048; ++value) {
+    table->append({value});
+  }
+  for (auto value = int64_t{10000}; value < 10100; ++value) {
+    table->append({value});
+  }
+  table->append({NULL_VALUE});
+  table->compress_chunk(ChunkID{0}, SegmentEncodingSpec{EncodingType::FrameOfReference});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  const auto row_count = [&](const ScanType scan_type, const AllTypeVariant& search_value) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+    scan->execute();
+    return scan->get_output()->row_count();
+  };
+
+  // Search value within the first block, i.e., above the range of the second block.
+  EXPECT_EQ(row_count(ScanType::OpEquals, int64_t{100}), 1);
+  EXPECT_EQ(row_count(ScanType::OpNotEquals, int64_t{100}), 2147);
+  EXPECT_EQ(row_count(ScanType::OpLessThan, int64_t{100}), 100);
+  EXPECT_EQ(row_count(ScanType::OpLessThanEquals, int64_t{100}), 101);
+  EXPECT_EQ(row_count(ScanType::OpGreaterThan, int64_t{100}), 2047);
+  EXPECT_EQ(row_count(ScanType::OpGreaterThanEquals, int64_t{100}), 2048);
+
+  // Search value between the two blocks.
+  EXPECT_EQ(row_count(ScanType::OpEquals, int64_t{5000}), 0);
+  EXPECT_EQ(row_count(ScanType::OpNotEquals, int64_t{5000}), 2148);
+  EXPECT_EQ(row_count(ScanType::OpLessThan, int64_t{5000}), 2048);
+  EXPECT_EQ(row_count(ScanType::OpGreaterThanEquals, int64_t{5000}), 100);
+
+  // Search value within the second block.
+  EXPECT_EQ(row_count(ScanType::OpGreaterThan, int64_t{10049}), 50);
+  EXPECT_EQ(row_count(ScanType::OpLessThanEquals, int64_t{10049}), 2098);
+
+  EXPECT_EQ(row_count(ScanType::OpLessThan, int64_t{-1}), 0);
+  EXPECT_EQ(row_count(ScanType::OpNotEquals, NULL_VALUE), 0);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDeltaEncodedSegment) {
+  // Sorted values with duplicates and NULL values across several blocks, and the same values in reversed order.
+  auto value_table = std::make_shared<Table>();
+  auto sorted_table = std::make_shared<Table>();
+  auto unsorted_table = std::make_shared<Table>();
+  for (const auto& table : {value_table, sorted_table, unsorted_table}) {
+    table->add_column("a", "int", true);
+  }
+  for (auto index = 0; index < 1000; ++index) {
+    const auto value = index % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index / 3};
+    value_table->append({value});
+    sorted_table->append({value});
+  }
+  for (auto index = 999; index >= 0; --index) {
+    unsorted_table->append({(*value_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[index]});
+  }
+  auto value_table_wrapper = std::make_shared<TableWrapper>(std::move(value_table));
+  value_table_wrapper->execute();
+
+  sorted_table->compress_chunk(ChunkID{0}, SegmentEncodingSpec{EncodingType::Delta});
+  unsorted_table->compress_chunk(ChunkID{0}, SegmentEncodingSpec{EncodingType::Delta});
+  ASSERT_TRUE(std::dynamic_pointer_cast<DeltaEncodedSegment<int32_t>>(
+                  sorted_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+                  ->is_sorted());
+
+  auto sorted_table_wrapper = std::make_shared<TableWrapper>(std::move(sorted_table));
+  sorted_table_wrapper->execute();
+  auto unsorted_table_wrapper = std::make_shared<TableWrapper>(std::move(unsorted_table));
+  unsorted_table_wrapper->execute();
+
+  const auto row_count = [&](const std::shared_ptr<TableWrapper>& table_wrapper, const ScanType scan_type,
+                             const AllTypeVariant& search_value) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+    scan->execute();
+    return scan->get_output()->row_count();
+  };
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto search_value : {-1, 0, 42, 43, 127, 128, 200, 332, 333, 1000}) {
+      const auto expected_row_count = row_count(value_table_wrapper, scan_type, search_value);
+      EXPECT_EQ(row_count(sorted_table_wrapper, scan_type, search_value), expected_row_count);
+      EXPECT_EQ(row_count(unsorted_table_wrapper, scan_type, search_value), expected_row_count);
+    }
+  }
+  EXPECT_EQ(row_count(sorted_table_wrapper, ScanType::OpNotEquals, NULL_VALUE), 0);
+}
+
+
+TEST_F(OperatorsTableScanTest, ScanOnGorillaSegment) {
+  auto expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+
+  auto table = load_table("src/test/tables/int_float.tbl", 2);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id, {SegmentEncodingSpec{EncodingType::FrameOfReference},
+                                     SegmentEncodingSpec{EncodingType::Gorilla}});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan_1->execute();
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9f);
+  scan_2->execute();
+
+  EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
+
+  auto scan_3 = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpLessThan, 457.9f);
+  scan_3->execute();
+  EXPECT_EQ(scan_3->get_output()->row_count(), 2);
+}
+
+
+TEST_F(OperatorsTableScanTest, ScanOnLZSegment) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", false);
+  table->add_column("b", "string", true);
+  for (auto index = int32_t{0}; index < 6; ++index) {
+    table->append({index, index % 2 == 0 ? AllTypeVariant{"even"} : NULL_VALUE});
+  }
+  // The first chunk is compressed from ValueSegments, the second one from DictionarySegments.
+  table->compress_chunk(ChunkID{0}, SegmentEncodingSpec{EncodingType::LZ});
+  table->compress_chunk(ChunkID{1});
+  table->compress_chunk(ChunkID{1}, SegmentEncodingSpec{EncodingType::LZ});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, "even");
+  scan_1->execute();
+  ASSERT_COLUMN_EQ(scan_1->get_output(), ColumnID{0}, {0, 2, 4});
+
+  auto scan_2 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan_2->execute();
+  ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{0}, {2, 3, 4, 5});
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnNarrowAndTemporalTypes) {
+  auto table = load_table("src/test/tables/typed_columns.tbl", 2);
+  // Byte and short columns are stored in integer encodings, the others in dictionaries.
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id, {SegmentEncodingSpec{EncodingType::FrameOfReference},
+                                     SegmentEncodingSpec{EncodingType::Delta}, SegmentEncodingSpec{},
+                                     SegmentEncodingSpec{}, SegmentEncodingSpec{}});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, int8_t{0});
+  scan_1->execute();
+  ASSERT_COLUMN_EQ(scan_1->get_output(), ColumnID{1}, {int16_t{-1000}, int16_t{32767}});
+
+  auto scan_2 = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpLessThanEquals, 0);
+  scan_2->execute();
+  ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{0}, {int8_t{7}, int8_t{0}});
+
+  auto scan_3 = std::make_shared<TableScan>(table_wrapper, ColumnID{2}, ScanType::OpGreaterThanEquals, "2023-06-15");
+  scan_3->execute();
+  ASSERT_COLUMN_EQ(scan_3->get_output(), ColumnID{0}, {int8_t{-5}, int8_t{127}});
+
+  auto scan_4 = std::make_shared<TableScan>(table_wrapper, ColumnID{3}, ScanType::OpLessThan,
+                                            Timestamp::parse("2000-01-01 00:00:01"));
+  scan_4->execute();
+  ASSERT_COLUMN_EQ(scan_4->get_output(), ColumnID{2}, {Date::parse("1999-12-31"), Date{0}});
+
+  auto scan_5 = std::make_shared<TableScan>(table_wrapper, ColumnID{4}, ScanType::OpEquals, "12.5");
+  scan_5->execute();
+  ASSERT_COLUMN_EQ(scan_5->get_output(), ColumnID{4}, {Decimal::parse("12.5"), Decimal::parse("12.5")});
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithZoneMaps) {
+  // Chunks of four rows with blocks of two rows. The first chunk stays a ValueSegment.
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int", true);
+  table->use_block_zone_maps(2);
+  for (const auto value : {1, 2, 3, 4, 5, 5, 6, 7, 8, 9}) {
+    table->append({value});
+  }
+  table->append({NULL_VALUE});
+  table->compress_chunk(ChunkID{1});
+  table->compress_chunk(ChunkID{2}, SegmentEncodingSpec{EncodingType::RunLength});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {5, 5};
+  tests[ScanType::OpNotEquals] = {1, 2, 3, 4, 6, 7, 8, 9};
+  tests[ScanType::OpLessThan] = {1, 2, 3, 4};
+  tests[ScanType::OpLessThanEquals] = {1, 2, 3, 4, 5, 5};
+  tests[ScanType::OpGreaterThan] = {6, 7, 8, 9};
+  tests[ScanType::OpGreaterThanEquals] = {5, 5, 6, 7, 8, 9};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 5);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, test.second);
+  }
+
+  // Blocks of the dictionary segment whose rows all qualify are emitted as a whole, other blocks are scanned.
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+  const auto output_segment = scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(output_segment);
+  EXPECT_EQ(reference_segment->pos_list()->size(), 9);
+  EXPECT_EQ(reference_segment->pos_list()->front(), (RowID{ChunkID{0}, 1}));
+  EXPECT_EQ(reference_segment->pos_list()->back(), (RowID{ChunkID{2}, 1}));
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithBloomFilters) {
+  // Every chunk covers the whole value range, so that only the Bloom filters can skip chunks.
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int", false);
+  table->add_column("b", "string", true);
+  for (const auto value : {0, 3, 5, 9, 0, 4, 6, 9, 0, 5, 7, 9}) {
+    table->append({value, value % 2 == 0 ? AllTypeVariant{std::to_string(value)} : NULL_VALUE});
+  }
+  table->append({5, "5"});
+  table->use_bloom_filter(ColumnID{0});
+  table->use_bloom_filter(ColumnID{1});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, SegmentEncodingSpec{EncodingType::RunLength});
+  table->compress_chunk(ChunkID{2}, {SegmentEncodingSpec{EncodingType::FrameOfReference}, SegmentEncodingSpec{}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  const auto expected_row_counts = std::vector<uint64_t>{3, 0, 0, 1, 1, 3, 1, 1, 0, 3};
+  for (auto value = int32_t{0}; value < 10; ++value) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, value);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), expected_row_counts[value]);
+  }
+
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, "4");
+  scan_1->execute();
+  ASSERT_COLUMN_EQ(scan_1->get_output(), ColumnID{0}, {4});
+
+  // Other predicates are not affected by the Bloom filters.
+  auto scan_2 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 5);
+  scan_2->execute();
+  EXPECT_EQ(scan_2->get_output()->row_count(), 10);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnSortedSegments) {
+  // The first chunk is sorted ascending with NULL values first, the second one descending with NULL values last. The
+  // third chunk is a sorted ValueSegment.
+  auto table = std::make_shared<Table>(6);
+  table->add_column("a", "int", true);
+  const auto values =
+      std::vector<AllTypeVariant>{NULL_VALUE, 1, 2, 2, 3, 5, 6, 4, 2, 2, NULL_VALUE, NULL_VALUE, 0, 2, 7};
+  for (const auto& value : values) {
+    table->append({value});
+  }
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking});
+  table->get_chunk(ChunkID{2})->set_sort_mode(ColumnID{0}, SortMode::AscendingNullsLast);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->sort_mode(ColumnID{0}), SortMode::AscendingNullsFirst);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->sort_mode(ColumnID{0}), SortMode::DescendingNullsLast);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {2, 2, 2, 2, 2};
+  tests[ScanType::OpNotEquals] = {1, 3, 5, 6, 4, 0, 7};
+  tests[ScanType::OpLessThan] = {1, 0};
+  tests[ScanType::OpLessThanEquals] = {1, 2, 2, 2, 2, 0, 2};
+  tests[ScanType::OpGreaterThan] = {3, 5, 6, 4, 7};
+  tests[ScanType::OpGreaterThanEquals] = {2, 2, 3, 5, 6, 4, 2, 2, 2, 7};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 2);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, test.second);
+  }
+
+  // Search values outside of the value range and missing from the dictionary.
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 4);
+  scan_1->execute();
+  ASSERT_COLUMN_EQ(scan_1->get_output(), ColumnID{0}, {1, 2, 2, 3, 2, 2, 0, 2});
+  auto scan_2 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 100);
+  scan_2->execute();
+  EXPECT_EQ(scan_2->get_output()->row_count(), 0);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnPartitionedTables) {
+  const auto values = std::vector<int32_t>{7, 42, 3, 18, 25, 11, 0, 33, 18, 29, 5, 40};
+  auto range_table = std::make_shared<Table>(2);
+  auto hash_table = std::make_shared<Table>(2);
+  for (const auto& table : {range_table, hash_table}) {
+    table->add_column("a", "int", true);
+  }
+  range_table->partition_by_range(ColumnID{0}, {10, 20, 30});
+  hash_table->partition_by_hash(ColumnID{0}, PartitionID{3});
+  for (const auto value : values) {
+    range_table->append({value});
+    hash_table->append({value});
+  }
+  range_table->append({NULL_VALUE});
+  range_table->compress_chunk(ChunkID{0});
+
+  // Skipping partitions does not change the result.
+  for (const auto& table : {range_table, hash_table}) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+      for (const auto search_value : {0, 10, 18, 19, 30, 45}) {
+        const auto expected_row_count = std::ranges::count_if(values, [&](const auto value) {
+          switch (scan_type) {
+            case ScanType::OpEquals:
+              return value == search_value;
+            case ScanType::OpNotEquals:
+              return value != search_value;
+            case ScanType::OpLessThan:
+              return value < search_value;
+            case ScanType::OpLessThanEquals:
+              return value <= search_value;
+            case ScanType::OpGreaterThan:
+              return value > search_value;
+            default:
+              return value >= search_value;
+          }
+        });
+        auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+        scan->execute();
+        EXPECT_EQ(scan->get_output()->row_count(), expected_row_count);
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOutsideOfTransactionSeesCommittedRows) {
+  const auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int", false);
+  table->append({1});
+  table->append({2});
+  table->compress_chunk(ChunkID{0});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto scanned_values = [&] {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+    scan->execute();
+    return scan->get_output();
+  };
+
+  // Like Table::rebalance_chunks before its commit, a transaction moves a row by deleting it and inserting a copy.
+  // Until the commit, scans outside of transactions see the row only in the old chunk, afterwards only in the new one.
+  const auto mover = TransactionManager::get().new_transaction_context();
+  ASSERT_TRUE(mover->try_delete(table->get_chunk(ChunkID{0})->mvcc_data(), 0));
+  table->append({1}, *mover);
+  ASSERT_COLUMN_EQ(scanned_values(), ColumnID{0}, {1, 2});
+
+  mover->commit();
+  ASSERT_COLUMN_EQ(scanned_values(), ColumnID{0}, {2, 1});
+
+  // Rows of rolled back transactions are never seen.
+  const auto writer = TransactionManager::get().new_transaction_context();
+  table->append({3}, *writer);
+  ASSERT_COLUMN_EQ(scanned_values(), ColumnID{0}, {2, 1});
+  writer->rollback();
+  ASSERT_COLUMN_EQ(scanned_values(), ColumnID{0}, {2, 1});
+}
+
+TEST_F(OperatorsTableScanTest, ScanWhileInserting) {
+  for (const auto use_delta_store : {false, true}) {
+    const auto table = std::make_shared<Table>(1'000);
+    table->add_column("a", "int", true);
+    table->add_column("b", "string", true);
+    if (use_delta_store) {
+      table->use_delta_store();
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    // Each transaction inserts a row with a value in both columns and a row with NULL values into the mutable chunks,
+    // whose segments grow while they are scanned. Every fifth transaction is rolled back.
+    auto writer_done = std::atomic<bool>{false};
+    auto writer = std::thread([&] {
+      for (auto value = int32_t{0}; value < 1'500; ++value) {
+        const auto transaction_context = TransactionManager::get().new_transaction_context();
+        table->append({value, std::to_string(value)}, *transaction_context);
+        table->append({NULL_VALUE, NULL_VALUE}, *transaction_context);
+        if (value % 5 == 4) {
+          transaction_context->rollback();
+        } else {
+          transaction_context->commit();
+        }
+      }
+      writer_done = true;
+    });
+
+    // Both scans see the same snapshot and thus the same rows, which only grow over time.
+    auto previous_row_count = size_t{0};
+    auto done = false;
+    while (!done) {
+      done = writer_done;
+      const auto transaction_context = TransactionManager::get().new_transaction_context();
+      auto int_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+      int_scan->set_transaction_context(transaction_context);
+      int_scan->execute();
+      auto string_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpNotEquals, "");
+      string_scan->set_transaction_context(transaction_context);
+      string_scan->execute();
+
+      const auto output = int_scan->get_output();
+      const auto row_count = output->row_count();
+      EXPECT_EQ(string_scan->get_output()->row_count(), row_count);
+      EXPECT_GE(row_count, previous_row_count);
+      previous_row_count = row_count;
+
+      const auto output_chunk = output->get_chunk(ChunkID{0});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        const auto value = boost::get<int32_t>((*output_chunk->get_segment(ColumnID{0}))[chunk_offset]);
+        EXPECT_NE(value % 5, 4);
+        EXPECT_EQ((*output_chunk->get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{std::to_string(value)});
+      }
+    }
+    writer.join();
+    EXPECT_EQ(previous_row_count, 1'200);
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,134 @@
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class OperatorsUpdateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "string", true);
+    _table->append({1, "one"});
+    _table->append({2, "two"});
+    _table->append({3, "three"});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  static std::shared_ptr<TableScan> scan_operator(const ColumnID column_id, const AllTypeVariant& search_value,
+                                                  const std::shared_ptr<TransactionContext>& transaction_context) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    auto scan = std::make_shared<TableScan>(get_table, column_id, ScanType::OpEquals, search_value);
+    scan->set_transaction_context(transaction_context);
+    scan->execute();
+    return scan;
+  }
+
+  // Returns the values of the second column of the rows whose first column equals the search value.
+  static std::vector<AllTypeVariant> lookup(const AllTypeVariant& search_value,
+                                            const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto scan = scan_operator(ColumnID{0}, search_value, transaction_context);
+    const auto segment = scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+      values.emplace_back((*segment)[chunk_offset]);
+    }
+    return values;
+  }
+
+  // Returns an operator whose output refers to the given positions in the table.
+  std::shared_ptr<TableWrapper> positions_operator(const std::initializer_list<RowID> row_ids) {
+    const auto pos_list = std::make_shared<PosList>(row_ids);
+    auto chunk = std::make_shared<Chunk>();
+    chunk->add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list));
+    chunk->add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{1}, pos_list));
+    auto table_wrapper = std::make_shared<TableWrapper>(std::make_shared<Table>(*_table, std::move(chunk)));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsUpdateTest, Update) {
+  auto& transaction_manager = TransactionManager::get();
+  const auto reader = transaction_manager.new_transaction_context();
+  const auto writer = transaction_manager.new_transaction_context();
+
+  auto update = std::make_shared<Update>("table", scan_operator(ColumnID{0}, 2, writer),
+                                         std::vector<std::pair<ColumnID, AllTypeVariant>>{{ColumnID{1}, NULL_VALUE}});
+  EXPECT_EQ(update->table_name(), "table");
+  update->set_transaction_context(writer);
+  update->execute();
+  EXPECT_FALSE(update->execute_failed());
+
+  // The new version of the row is appended, the old one is deleted.
+  EXPECT_EQ(_table->row_count(), 4);
+  const auto updated_values = lookup(2, writer);
+  ASSERT_EQ(updated_values.size(), 1);
+  EXPECT_TRUE(variant_is_null(updated_values[0]));
+  EXPECT_EQ(lookup(2, reader), (std::vector<AllTypeVariant>{"two"}));
+
+  // Concurrent updates of the same row fail.
+  auto conflicting_update =
+      std::make_shared<Update>("table", scan_operator(ColumnID{0}, 2, nullptr),
+                               std::vector<std::pair<ColumnID, AllTypeVariant>>{{ColumnID{1}, "zwei"}});
+  conflicting_update->execute();
+  EXPECT_TRUE(conflicting_update->execute_failed());
+  EXPECT_EQ(_table->approx_valid_row_count(), 4);
+
+  writer->commit();
+  EXPECT_EQ(lookup(2, reader), (std::vector<AllTypeVariant>{"two"}));
+  EXPECT_TRUE(variant_is_null(lookup(2, transaction_manager.new_transaction_context())[0]));
+  EXPECT_EQ(_table->approx_valid_row_count(), 3);
+
+  // Updates without a transaction are committed right away.
+  auto auto_commit_update =
+      std::make_shared<Update>("table", scan_operator(ColumnID{1}, "three", nullptr),
+                               std::vector<std::pair<ColumnID, AllTypeVariant>>{{ColumnID{0}, 30}});
+  auto_commit_update->execute();
+  EXPECT_FALSE(auto_commit_update->execute_failed());
+  EXPECT_EQ(lookup(30, transaction_manager.new_transaction_context()), (std::vector<AllTypeVariant>{"three"}));
+  EXPECT_TRUE(lookup(3, transaction_manager.new_transaction_context()).empty());
+
+  EXPECT_THROW(Update("table", scan_operator(ColumnID{0}, 1, nullptr),
+                      std::vector<std::pair<ColumnID, AllTypeVariant>>{{ColumnID{2}, 1}})
+                   .execute(),
+               std::logic_error);
+}
+
+TEST_F(OperatorsUpdateTest, SkipNullPositions) {
+  // NULL positions do not refer to rows, so there is nothing to update.
+  auto update = std::make_shared<Update>("table", positions_operator({NULL_ROW_ID, RowID{ChunkID{0}, ChunkOffset{1}}}),
+                                         std::vector<std::pair<ColumnID, AllTypeVariant>>{{ColumnID{1}, "zwei"}});
+  update->execute();
+  EXPECT_FALSE(update->execute_failed());
+  EXPECT_EQ(_table->row_count(), 4);
+  EXPECT_EQ(_table->approx_valid_row_count(), 3);
+  EXPECT_EQ(lookup(2, TransactionManager::get().new_transaction_context()), (std::vector<AllTypeVariant>{"zwei"}));
+}
+
+TEST_F(OperatorsUpdateTest, UpdateDuplicatePositionsOnce) {
+  // A row that occurs more than once in the input gets only one new version.
+  const auto row_id = RowID{ChunkID{1}, ChunkOffset{0}};
+  auto update = std::make_shared<Update>("table", positions_operator({row_id, row_id}),
+                                         std::vector<std::pair<ColumnID, AllTypeVariant>>{{ColumnID{1}, "drei"}});
+  update->execute();
+  EXPECT_FALSE(update->execute_failed());
+  EXPECT_EQ(_table->row_count(), 4);
+  EXPECT_EQ(_table->approx_valid_row_count(), 3);
+  EXPECT_EQ(lookup(3, TransactionManager::get().new_transaction_context()), (std::vector<AllTypeVariant>{"drei"}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,140 @@
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/column_batch.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table_writer.hpp"
+
+namespace opossum {
+
+class OperatorsValidateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "string", true);
+    _table->append({1, "a"});
+    _table->append({2, "b"});
+    _table->append({3, NULL_VALUE});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // Returns the values of the first column of the operator's output.
+  static std::vector<AllTypeVariant> first_column(const AbstractOperator& op) {
+    auto values = std::vector<AllTypeVariant>{};
+    const auto output = op.get_output();
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto segment = output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+        values.emplace_back((*segment)[chunk_offset]);
+      }
+    }
+    return values;
+  }
+
+  std::vector<AllTypeVariant> validate(const std::shared_ptr<const AbstractOperator>& in,
+                                       const std::shared_ptr<TransactionContext>& transaction_context) {
+    auto validate = std::make_shared<Validate>(in);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return first_column(*validate);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsValidateTest, ValidateTable) {
+  auto& transaction_manager = TransactionManager::get();
+  const auto reader = transaction_manager.new_transaction_context();
+  const auto writer = transaction_manager.new_transaction_context();
+  _table->append({4, "d"}, *writer);
+  _table->append({5, "e"});
+
+  EXPECT_EQ(validate(_table_wrapper, reader), (std::vector<AllTypeVariant>{1, 2, 3}));
+  EXPECT_EQ(validate(_table_wrapper, writer), (std::vector<AllTypeVariant>{1, 2, 3, 4}));
+  writer->commit();
+  EXPECT_EQ(validate(_table_wrapper, transaction_manager.new_transaction_context()),
+            (std::vector<AllTypeVariant>{1, 2, 3, 4, 5}));
+
+  // Validate needs a transaction.
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  EXPECT_THROW(validate->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsValidateTest, ValidateScanOutput) {
+  auto& transaction_manager = TransactionManager::get();
+  const auto reader = transaction_manager.new_transaction_context();
+  _table->append({4, "d"});
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+  EXPECT_EQ(validate(scan, reader), (std::vector<AllTypeVariant>{2, 3}));
+
+  auto validate = std::make_shared<Validate>(scan);
+  validate->set_transaction_context(reader);
+  validate->execute();
+  // The output refers to the table.
+  const auto output_chunk = validate->get_output()->get_chunk(ChunkID{0});
+  const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(output_chunk->get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table);
+}
+
+TEST_F(OperatorsValidateTest, ScanInTransaction) {
+  auto& transaction_manager = TransactionManager::get();
+  const auto reader = transaction_manager.new_transaction_context();
+  _table->compress_chunk(ChunkID{0});
+  _table->append({4, "d"});
+
+  // Scans that are executed in a transaction only return the visible rows, also from compressed chunks.
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  scan->set_transaction_context(reader);
+  scan->execute();
+  EXPECT_EQ(first_column(*scan), (std::vector<AllTypeVariant>{2, 3}));
+  EXPECT_THROW(scan->set_transaction_context(nullptr), std::logic_error);
+
+  auto scan_without_transaction = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 4);
+  scan_without_transaction->execute();
+  EXPECT_EQ(first_column(*scan_without_transaction), (std::vector<AllTypeVariant>{4}));
+}
+
+TEST_F(OperatorsValidateTest, RowsKeepTheirVersions) {
+  auto& transaction_manager = TransactionManager::get();
+  const auto reader = transaction_manager.new_transaction_context();
+
+  // Rows appended in bulk or by TableWriters are committed at once.
+  const auto values = std::vector<int32_t>{9, 8};
+  const auto strings = std::vector<std::string>{"i", "h"};
+  _table->append_columns(
+      {std::make_shared<ColumnBatch<int32_t>>(values), std::make_shared<ColumnBatch<std::string>>(strings)});
+  {
+    auto table_writer = TableWriter{*_table};
+    table_writer.append({7, "g"});
+  }
+  const auto second_reader = transaction_manager.new_transaction_context();
+  EXPECT_EQ(validate(_table_wrapper, reader), (std::vector<AllTypeVariant>{1, 2, 3}));
+  EXPECT_EQ(validate(_table_wrapper, second_reader), (std::vector<AllTypeVariant>{1, 2, 3, 9, 8, 7}));
+
+  // Clustering moves the rows, but not their versions.
+  _table->cluster({ColumnID{0}});
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  EXPECT_EQ(validate(table_wrapper, reader), (std::vector<AllTypeVariant>{1, 2, 3}));
+  EXPECT_EQ(validate(table_wrapper, second_reader), (std::vector<AllTypeVariant>{1, 2, 3, 7, 8, 9}));
+
+  // Rebalancing rewrites the rows in a transaction, so that running transactions still see the old chunks.
+  _table->rebalance_chunks(3, 6);
+  EXPECT_EQ(validate(table_wrapper, reader), (std::vector<AllTypeVariant>{1, 2, 3}));
+  EXPECT_EQ(validate(table_wrapper, second_reader), (std::vector<AllTypeVariant>{1, 2, 3, 7, 8, 9}));
+  EXPECT_EQ(validate(table_wrapper, transaction_manager.new_transaction_context()),
+            (std::vector<AllTypeVariant>{1, 2, 3, 7, 8, 9}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#include "base_test.hpp"
+
+#include "storage/bit_packed_integer_vector.hpp"
+
+namespace opossum {
+
+class StorageBitPackedIntegerVectorTest : public BaseTest {};
+
+TEST_F(StorageBitPackedIntegerVectorTest, GetAndSetForAllWidths) {
+  for (auto bit_width = uint8_t{1}; bit_width <= 32; ++bit_width) {
+    const auto max_value = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    auto vector = BitPackedIntegerVector{200, bit_width};
+    EXPECT_EQ(vector.size(), 200);
+    EXPECT_EQ(vector.bit_width(), bit_width);
+
+    for (auto index = size_t{0}; index < vector.size(); ++index) {
+      vector.set(index, ValueID{static_cast<uint32_t>(index * 2654435761u) & max_value});
+    }
+    for (auto index = size_t{0}; index < vector.size(); ++index) {
+      EXPECT_EQ(vector.get(index), ValueID{static_cast<uint32_t>(index * 2654435761u) & max_value});
+    }
+  }
+}
+
+TEST_F(StorageBitPackedIntegerVectorTest, OverwriteKeepsNeighbors) {
+  auto vector = BitPackedIntegerVector{3, 7};
+  vector.set(0, ValueID{127});
+  vector.set(1, ValueID{127});
+  vector.set(2, ValueID{127});
+  vector.set(1, ValueID{5});
+
+  EXPECT_EQ(vector.get(0), ValueID{127});
+  EXPECT_EQ(vector.get(1), ValueID{5});
+  EXPECT_EQ(vector.get(2), ValueID{127});
+}
+
+TEST_F(StorageBitPackedIntegerVectorTest, RejectsInvalidWidthsAndValues) {
+  EXPECT_THROW((BitPackedIntegerVector{10, 0}), std::logic_error);
+  EXPECT_THROW((BitPackedIntegerVector{10, 33}), std::logic_error);
+
+  auto vector = BitPackedIntegerVector{10, 3};
+  EXPECT_THROW(vector.set(0, ValueID{8}), std::logic_error);
+  EXPECT_THROW(vector.set(10, ValueID{1}), std::logic_error);
+}
+
+TEST_F(StorageBitPackedIntegerVectorTest, UnpackBlock) {
+  auto vector = BitPackedIntegerVector{100, 9};
+  for (auto index = size_t{0}; index < vector.size(); ++index) {
+    vector.set(index, ValueID{static_cast<uint32_t>(index * 5)});
+  }
+
+  auto block = std::array<ValueID, BitPackedIntegerVector::BLOCK_SIZE>{};
+  vector.unpack_block(0, block);
+  for (auto index = size_t{0}; index < BitPackedIntegerVector::BLOCK_SIZE; ++index) {
+    EXPECT_EQ(block[index], ValueID{static_cast<uint32_t>(index * 5)});
+  }
+
+  // The second block is only partially filled and padded with zeros.
+  vector.unpack_block(1, block);
+  for (auto index = size_t{0}; index < 36; ++index) {
+    EXPECT_EQ(block[index], ValueID{static_cast<uint32_t>((64 + index) * 5)});
+  }
+  EXPECT_EQ(block[36], ValueID{0});
+}
+
+TEST_F(StorageBitPackedIntegerVectorTest, Decode) {
+  auto vector = BitPackedIntegerVector{300, 11};
+  for (auto index = size_t{0}; index < vector.size(); ++index) {
+    vector.set(index, ValueID{static_cast<uint32_t>(index + 1000)});
+  }
+
+  // Unaligned begin, several whole blocks, and an unaligned end.
+  auto output = std::vector<ValueID>(250);
+  vector.decode(13, output);
+  for (auto index = size_t{0}; index < output.size(); ++index) {
+    EXPECT_EQ(output[index], ValueID{static_cast<uint32_t>(index + 13 + 1000)});
+  }
+
+  EXPECT_THROW(vector.decode(100, output), std::logic_error);
+}
+
+TEST_F(StorageBitPackedIntegerVectorTest, MemoryUsageAndWidth) {
+  const auto vector = BitPackedIntegerVector{300, 9};
+  // 5 blocks of 64 values, each occupying 9 words of 8 bytes.
+  EXPECT_EQ(vector.estimate_memory_usage(), 5 * 9 * 8);
+  EXPECT_EQ(vector.width(), 2);
+}
+
+}  // namespace opossum
@@ -0,0 +1,81 @@
+#include "base_test.hpp"
+
+#include "storage/bitmap.hpp"
+
+namespace opossum {
+
+class StorageBitmapTest : public BaseTest {};
+
+TEST_F(StorageBitmapTest, AccessAndResize) {
+  auto bitmap = Bitmap{};
+  EXPECT_TRUE(bitmap.empty());
+  for (auto index = 0; index < 100; ++index) {
+    bitmap.push_back(index % 3 == 0);
+  }
+  EXPECT_EQ(bitmap.size(), 100);
+  EXPECT_EQ(bitmap.word_count(), 2);
+  EXPECT_TRUE(bitmap[0]);
+  EXPECT_FALSE(bitmap[1]);
+  EXPECT_TRUE(bitmap[99]);
+  EXPECT_EQ(bitmap.word(0) & 0b1111, 0b1001);
+
+  bitmap.set(1);
+  bitmap.set(99, false);
+  EXPECT_TRUE(bitmap[1]);
+  EXPECT_FALSE(bitmap[99]);
+
+  bitmap.resize(130, true);
+  EXPECT_EQ(bitmap.word_count(), 3);
+  EXPECT_FALSE(bitmap[99]);
+  EXPECT_TRUE(bitmap[100]);
+  EXPECT_TRUE(bitmap[129]);
+
+  // Bits that are cut off are cleared so that growing again does not bring them back.
+  bitmap.resize(101);
+  bitmap.resize(130);
+  EXPECT_TRUE(bitmap[100]);
+  EXPECT_FALSE(bitmap[101]);
+  EXPECT_EQ(bitmap.estimate_memory_usage(), 3 * 8);
+
+  EXPECT_EQ(Bitmap(70, true).count(), 70);
+  EXPECT_EQ((Bitmap{true, false, true}), (Bitmap{true, false, true}));
+  EXPECT_NE((Bitmap{true, false, true}), (Bitmap{true, false}));
+}
+
+TEST_F(StorageBitmapTest, FindNext) {
+  auto bitmap = Bitmap(200);
+  bitmap.set(3);
+  bitmap.set(64);
+  bitmap.set(190);
+
+  EXPECT_EQ(bitmap.find_next_set(0), 3);
+  EXPECT_EQ(bitmap.find_next_set(4), 64);
+  EXPECT_EQ(bitmap.find_next_set(65), 190);
+  EXPECT_EQ(bitmap.find_next_set(191), 200);
+  EXPECT_EQ(bitmap.find_next_set(500), 200);
+
+  auto full_bitmap = Bitmap(130, true);
+  full_bitmap.set(70, false);
+  EXPECT_EQ(full_bitmap.find_next_unset(0), 70);
+  EXPECT_EQ(full_bitmap.find_next_unset(71), 130);
+  EXPECT_EQ(bitmap.find_next_unset(3), 4);
+}
+
+TEST_F(StorageBitmapTest, BitwiseOperations) {
+  auto selection = Bitmap{true, true, false, true, true};
+  const auto null_values = Bitmap{false, true, true, false, false};
+
+  auto non_null_selection = selection;
+  non_null_selection.and_not(null_values);
+  EXPECT_EQ(non_null_selection, (Bitmap{true, false, false, true, true}));
+  EXPECT_EQ(non_null_selection.count(), 3);
+
+  selection &= null_values;
+  EXPECT_EQ(selection, (Bitmap{false, true, false, false, false}));
+  selection |= null_values;
+  EXPECT_EQ(selection, null_values);
+
+  EXPECT_THROW(selection &= Bitmap(4), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#include "base_test.hpp"
+
+#include "storage/bloom_filter.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, ContainsInsertedValues) {
+  auto bloom_filter = BloomFilter{1000};
+  for (auto value = int32_t{0}; value < 2000; value += 2) {
+    bloom_filter.insert(value);
+  }
+
+  auto false_positive_count = 0;
+  for (auto value = int32_t{0}; value < 2000; value += 2) {
+    EXPECT_TRUE(bloom_filter.may_contain(value));
+    false_positive_count += bloom_filter.may_contain(value + 1);
+  }
+  // About 1% false positives are expected with 10 bits per value.
+  EXPECT_LT(false_positive_count, 50);
+}
+
+TEST_F(StorageBloomFilterTest, Strings) {
+  auto bloom_filter = BloomFilter{2};
+  bloom_filter.insert(std::string_view{"Hello"});
+  bloom_filter.insert(std::string{"world"});
+  EXPECT_TRUE(bloom_filter.may_contain(std::string{"Hello"}));
+  EXPECT_TRUE(bloom_filter.may_contain(std::string_view{"world"}));
+}
+
+TEST_F(StorageBloomFilterTest, Sizing) {
+  EXPECT_EQ(BloomFilter{1000}.hash_count(), 7);
+  EXPECT_EQ(BloomFilter(1000, 1).hash_count(), 1);
+  EXPECT_EQ(BloomFilter{1000}.estimate_memory_usage(), 10'048 / 8);
+  // Empty filters still consist of one word.
+  EXPECT_EQ(BloomFilter{0}.estimate_memory_usage(), 8);
+  EXPECT_FALSE(BloomFilter{0}.may_contain(17));
+  EXPECT_THROW(BloomFilter(10, 0), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,156 @@
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_compactor.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StorageChunkCompactorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table->add_column("a", "int", false);
+    for (auto index = int32_t{0}; index < 40; ++index) {
+      table->append({index});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+      table->compress_chunk(chunk_id);
+    }
+  }
+
+  // Deletes the rows of the chunk in the range [begin, end).
+  void delete_rows(const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end) {
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+      ASSERT_TRUE(transaction_context->try_delete(table->get_chunk(chunk_id)->mvcc_data(), chunk_offset));
+    }
+    transaction_context->commit();
+  }
+
+  // Returns the number of rows that are visible to the transaction.
+  size_t visible_row_count(const std::shared_ptr<TransactionContext>& transaction_context) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    auto validate = std::make_shared<Validate>(table_wrapper);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output()->get_chunk(ChunkID{0})->size();
+  }
+
+  std::shared_ptr<Table> table{std::make_shared<Table>(10)};
+};
+
+TEST_F(StorageChunkCompactorTest, CompactChunks) {
+  auto& transaction_manager = TransactionManager::get();
+  delete_rows(ChunkID{0}, 0, 6);
+  delete_rows(ChunkID{1}, 0, 2);
+  const auto reader = transaction_manager.new_transaction_context();
+  delete_rows(ChunkID{2}, 0, 10);
+  EXPECT_EQ(table->approx_valid_row_count(), 22);
+
+  // The valid rows of the first chunk are moved to a new chunk, the fully invalidated third chunk is still visible to
+  // the reader.
+  EXPECT_EQ(table->compact_chunks(0.5), (std::vector<ChunkID>{ChunkID{0}}));
+  ASSERT_EQ(table->chunk_count(), 5);
+  EXPECT_EQ(table->get_chunk(ChunkID{4})->size(), 4);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->mvcc_data()->invalidated_row_count(), 10);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 10);
+  EXPECT_EQ(table->approx_valid_row_count(), 22);
+  EXPECT_EQ(visible_row_count(reader), 32);
+  EXPECT_EQ(visible_row_count(transaction_manager.new_transaction_context()), 22);
+
+  // Once no transaction can see their rows anymore, fully invalidated chunks are emptied.
+  reader->commit();
+  EXPECT_TRUE(table->compact_chunks(0.5).empty());
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 0);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 0);
+  EXPECT_EQ(table->row_count(), 24);
+  EXPECT_EQ(table->approx_valid_row_count(), 22);
+  EXPECT_EQ(visible_row_count(transaction_manager.new_transaction_context()), 22);
+
+  EXPECT_EQ(table->compact_chunks(0.2), (std::vector<ChunkID>{ChunkID{1}}));
+  EXPECT_THROW(table->compact_chunks(0.0), std::logic_error);
+}
+
+TEST_F(StorageChunkCompactorTest, ReusesReclaimedChunks) {
+  // Each compaction moves the rows to the chunk that the previous compaction emptied.
+  for (auto round = 0; round < 8; ++round) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (table->get_chunk(chunk_id)->size() > 1) {
+        delete_rows(chunk_id, 0, 1);
+      }
+    }
+    table->compact_chunks(0.05);
+    EXPECT_LE(table->chunk_count(), 5);
+  }
+  EXPECT_EQ(table->approx_valid_row_count(), 8);
+  EXPECT_EQ(table->row_count(), 8);
+  EXPECT_EQ(visible_row_count(TransactionManager::get().new_transaction_context()), 8);
+}
+
+TEST_F(StorageChunkCompactorTest, KeepsChunksReferencedByScans) {
+  delete_rows(ChunkID{0}, 0, 10);
+  EXPECT_TRUE(table->compact_chunks(0.5).empty());
+  ASSERT_EQ(table->get_chunk(ChunkID{0})->size(), 0);
+
+  // The output of a scan outside of a transaction keeps positions into the second chunk. While it is alive, the chunk
+  // is neither reclaimed nor is the id of the first chunk reused.
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 20);
+  scan->execute();
+  delete_rows(ChunkID{1}, 0, 8);
+  EXPECT_EQ(table->compact_chunks(0.5), (std::vector<ChunkID>{ChunkID{1}}));
+  EXPECT_EQ(table->chunk_count(), 5);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 0);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 10);
+
+  {
+    const auto output_segment = scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+    ASSERT_EQ(output_segment->size(), 10);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10; ++chunk_offset) {
+      EXPECT_EQ((*output_segment)[chunk_offset], AllTypeVariant{static_cast<int32_t>(10 + chunk_offset)});
+    }
+  }
+
+  // Once the output is gone, the chunk is reclaimed.
+  scan = nullptr;
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 10);
+  EXPECT_TRUE(table->compact_chunks(0.5).empty());
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 0);
+  EXPECT_EQ(visible_row_count(TransactionManager::get().new_transaction_context()), 22);
+}
+
+TEST_F(StorageChunkCompactorTest, SkipsChunksHeldByTransactions) {
+  delete_rows(ChunkID{0}, 0, 8);
+  const auto deleter = TransactionManager::get().new_transaction_context();
+  ASSERT_TRUE(deleter->try_delete(table->get_chunk(ChunkID{0})->mvcc_data(), 9));
+  EXPECT_TRUE(table->compact_chunks(0.5).empty());
+
+  deleter->rollback();
+  EXPECT_EQ(table->compact_chunks(0.5), (std::vector<ChunkID>{ChunkID{0}}));
+}
+
+TEST_F(StorageChunkCompactorTest, CompactsInBackground) {
+  EXPECT_THROW(ChunkCompactor(nullptr, std::chrono::milliseconds{1}), std::logic_error);
+  EXPECT_THROW(ChunkCompactor(table, std::chrono::milliseconds{1}, 1.5), std::logic_error);
+
+  auto compactor = ChunkCompactor(table, std::chrono::milliseconds{1}, 0.5);
+  delete_rows(ChunkID{1}, 2, 9);
+  delete_rows(ChunkID{3}, 0, 5);
+
+  // Wait for the background thread to compact both chunks.
+  for (auto attempt = 0; attempt < 1'000 && compactor.compacted_chunk_count() < 2; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+  }
+  ASSERT_EQ(compactor.compacted_chunk_count(), 2);
+  compactor.compact_now();
+  EXPECT_EQ(visible_row_count(TransactionManager::get().new_transaction_context()), 28);
+}
+
+}  // namespace opossum
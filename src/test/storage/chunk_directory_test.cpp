@@ -0,0 +1,84 @@
+#include <atomic>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_directory.hpp"
+
+namespace opossum {
+
+class StorageChunkDirectoryTest : public BaseTest {
+ protected:
+  ChunkDirectory chunk_directory;
+};
+
+TEST_F(StorageChunkDirectoryTest, AppendAndAccess) {
+  EXPECT_EQ(chunk_directory.size(), 0);
+  const auto chunk_a = std::make_shared<Chunk>();
+  const auto chunk_b = std::make_shared<Chunk>();
+  EXPECT_EQ(chunk_directory.append(chunk_a, false, PartitionID{0}), ChunkID{0});
+  EXPECT_EQ(chunk_directory.append(chunk_b, true, PartitionID{2}), ChunkID{1});
+  EXPECT_EQ(chunk_directory.size(), 2);
+  EXPECT_EQ(chunk_directory.get(ChunkID{0}), chunk_a);
+  EXPECT_EQ(chunk_directory.get(ChunkID{1}), chunk_b);
+  EXPECT_FALSE(chunk_directory.is_mutable(ChunkID{0}));
+  EXPECT_TRUE(chunk_directory.is_mutable(ChunkID{1}));
+  EXPECT_EQ(chunk_directory.partition_id(ChunkID{1}), PartitionID{2});
+  EXPECT_THROW(chunk_directory.get(ChunkID{2}), std::logic_error);
+
+  chunk_directory.replace(ChunkID{1}, chunk_a);
+  chunk_directory.set_immutable(ChunkID{1});
+  EXPECT_EQ(chunk_directory.get(ChunkID{1}), chunk_a);
+  EXPECT_FALSE(chunk_directory.is_mutable(ChunkID{1}));
+
+  chunk_directory.clear();
+  EXPECT_EQ(chunk_directory.size(), 0);
+  EXPECT_EQ(chunk_a.use_count(), 1);
+  EXPECT_EQ(chunk_directory.append(chunk_b, true, PartitionID{0}), ChunkID{0});
+}
+
+TEST_F(StorageChunkDirectoryTest, SlotsDoNotMove) {
+  // Chunks are spread over several blocks, and earlier slots stay valid while the directory grows.
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto index = 0; index < 1000; ++index) {
+    chunks.emplace_back(std::make_shared<Chunk>());
+    chunk_directory.append(chunks.back(), true, PartitionID{static_cast<uint16_t>(index % 3)});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < 1000; ++chunk_id) {
+    EXPECT_EQ(chunk_directory.get(chunk_id), chunks[chunk_id]);
+    EXPECT_EQ(chunk_directory.partition_id(chunk_id), PartitionID{static_cast<uint16_t>(chunk_id % 3)});
+  }
+}
+
+TEST_F(StorageChunkDirectoryTest, ConcurrentAppendAndRead) {
+  constexpr auto CHUNK_COUNT = ChunkID{20'000};
+  auto done = std::atomic<bool>{false};
+  auto failed = std::atomic<bool>{false};
+
+  auto readers = std::vector<std::thread>{};
+  for (auto reader_index = 0; reader_index < 4; ++reader_index) {
+    readers.emplace_back([&]() {
+      while (!done) {
+        const auto size = chunk_directory.size();
+        for (auto chunk_id = ChunkID{size > 8 ? size - 8 : 0}; chunk_id < size; ++chunk_id) {
+          if (!chunk_directory.get(chunk_id)) {
+            failed = true;
+          }
+        }
+      }
+    });
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < CHUNK_COUNT; ++chunk_id) {
+    chunk_directory.append(std::make_shared<Chunk>(), true, PartitionID{0});
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_FALSE(failed);
+  EXPECT_EQ(chunk_directory.size(), CHUNK_COUNT);
+}
+
+}  // namespace opossum
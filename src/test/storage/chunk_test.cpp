@@ -81,4 +81,12 @@ TEST_F(StorageChunkTest, ColumnCount) {
   EXPECT_EQ(chunk.column_count(), 2);
 }
 
+TEST_F(StorageChunkTest, SortMode) {
+  chunk.add_segment(int_value_segment);
+  EXPECT_EQ(chunk.sort_mode(ColumnID{0}), std::nullopt);
+  chunk.set_sort_mode(ColumnID{0}, SortMode::DescendingNullsLast);
+  EXPECT_EQ(chunk.sort_mode(ColumnID{0}), SortMode::DescendingNullsLast);
+  EXPECT_THROW(chunk.sort_mode(ColumnID{1}), std::logic_error);
+}
+
 }  // namespace opossum
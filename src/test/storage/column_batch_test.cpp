@@ -0,0 +1,76 @@
+#include "base_test.hpp"
+
+#include "storage/column_batch.hpp"
+#include "storage/unsorted_dictionary_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/zone_map.hpp"
+
+namespace opossum {
+
+class StorageColumnBatchTest : public BaseTest {
+ protected:
+  const std::vector<int32_t> values{4, 0, 9, 2, 7};
+  const Bitmap null_values{false, true, false, false, false};
+  const ColumnBatch<int32_t> column_batch{values, &null_values};
+};
+
+TEST_F(StorageColumnBatchTest, Values) {
+  EXPECT_EQ(column_batch.size(), 5);
+  EXPECT_FALSE(column_batch.is_null(0));
+  EXPECT_TRUE(column_batch.is_null(1));
+  EXPECT_EQ(column_batch[2], AllTypeVariant{9});
+  EXPECT_TRUE(variant_is_null(column_batch[1]));
+  EXPECT_EQ(column_batch.values().size(), 5);
+  EXPECT_EQ(column_batch.null_values(), &null_values);
+
+  const auto null_values_of_wrong_size = Bitmap{false, true};
+  EXPECT_THROW((ColumnBatch<int32_t>{values, &null_values_of_wrong_size}), std::logic_error);
+}
+
+TEST_F(StorageColumnBatchTest, AppendToValueSegment) {
+  auto segment = ValueSegment<int32_t>{true};
+  auto zone_map = ZoneMap<int32_t>{2};
+  segment.append(1);
+  zone_map.append(1);
+  column_batch.append_to(segment, &zone_map, 1, 4);
+
+  EXPECT_EQ(segment.size(), 4);
+  const auto values = segment.values();
+  EXPECT_EQ(std::vector(values.begin(), values.end()), (std::vector<int32_t>{1, 0, 9, 2}));
+  EXPECT_TRUE(segment.is_null(1));
+  EXPECT_FALSE(segment.is_null(2));
+  EXPECT_EQ(zone_map.zone().min, 1);
+  EXPECT_EQ(zone_map.zone().max, 9);
+  EXPECT_EQ(zone_map.zone().null_count, 1);
+  EXPECT_EQ(zone_map.block_zones()[1].min, 2);
+
+  // NULL values cannot be appended to non-nullable segments.
+  auto non_nullable_segment = ValueSegment<int32_t>{false};
+  EXPECT_THROW(column_batch.append_to(non_nullable_segment, nullptr, 0, 5), std::logic_error);
+  column_batch.append_to(non_nullable_segment, nullptr, 2, 5);
+  const auto non_nullable_values = non_nullable_segment.values();
+  EXPECT_EQ(std::vector(non_nullable_values.begin(), non_nullable_values.end()), (std::vector<int32_t>{9, 2, 7}));
+}
+
+TEST_F(StorageColumnBatchTest, AppendStrings) {
+  const auto strings = std::vector<std::string>{"Bill", "a rather long string that is not inlined", "Steve"};
+  const auto string_column_batch = ColumnBatch<std::string>{strings};
+  EXPECT_EQ(string_column_batch.null_values(), nullptr);
+
+  auto value_segment = ValueSegment<std::string>{};
+  string_column_batch.append_to(value_segment, nullptr, 0, 3);
+  EXPECT_EQ(value_segment.get(1), strings[1]);
+
+  auto dictionary_segment = UnsortedDictionarySegment<std::string>{false};
+  string_column_batch.append_to(dictionary_segment, nullptr, 0, 3);
+  string_column_batch.append_to(dictionary_segment, nullptr, 0, 1);
+  EXPECT_EQ(dictionary_segment.size(), 4);
+  EXPECT_EQ(dictionary_segment.unique_values_count(), 3);
+  EXPECT_EQ(dictionary_segment.get(3), "Bill");
+
+  // The batch's type has to match the segment's type.
+  auto int_segment = ValueSegment<int32_t>{};
+  EXPECT_THROW(string_column_batch.append_to(int_segment, nullptr, 0, 3), std::logic_error);
+}
+
+}  // namespace opossum
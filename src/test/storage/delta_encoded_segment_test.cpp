@@ -0,0 +1,77 @@
+#include "base_test.hpp"
+
+#include "storage/delta_encoded_segment.hpp"
+
+namespace opossum {
+
+class StorageDeltaEncodedSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+  std::shared_ptr<ValueSegment<int64_t>> value_segment_long{std::make_shared<ValueSegment<int64_t>>()};
+};
+
+TEST_F(StorageDeltaEncodedSegmentTest, CompressSortedSegment) {
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(1000);
+  value_segment_int->append(1003);
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(1010);
+
+  const auto delta_segment = std::make_shared<DeltaEncodedSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(delta_segment->size(), 5);
+  EXPECT_TRUE(delta_segment->is_sorted());
+  EXPECT_EQ(delta_segment->checkpoints(), std::vector<int32_t>{1000});
+
+  EXPECT_EQ(delta_segment->get_typed_value(0), std::nullopt);
+  EXPECT_EQ(delta_segment->get(1), 1000);
+  EXPECT_EQ(delta_segment->get(2), 1003);
+  EXPECT_TRUE(variant_is_null((*delta_segment)[3]));
+  EXPECT_EQ((*delta_segment)[4], AllTypeVariant{1010});
+  EXPECT_THROW(delta_segment->get(3), std::logic_error);
+  EXPECT_THROW(delta_segment->get(5), std::logic_error);
+
+  // NULL values repeat the neighboring values.
+  auto block = std::array<int32_t, DeltaEncodedSegment<int32_t>::BLOCK_SIZE>{};
+  delta_segment->decode_block(0, block);
+  EXPECT_EQ((std::vector<int32_t>{block.begin(), block.begin() + 5}),
+            (std::vector<int32_t>{1000, 1000, 1003, 1003, 1010}));
+}
+
+TEST_F(StorageDeltaEncodedSegmentTest, UnsortedValuesAndMultipleBlocks) {
+  constexpr auto BLOCK_SIZE = DeltaEncodedSegment<int64_t>::BLOCK_SIZE;
+  const auto min = std::numeric_limits<int64_t>::min();
+  const auto max = std::numeric_limits<int64_t>::max();
+  for (auto index = int64_t{0}; index < BLOCK_SIZE; ++index) {
+    value_segment_long->append(min + index);
+  }
+  for (auto index = int64_t{0}; index < 10; ++index) {
+    value_segment_long->append(max - index);
+  }
+
+  const auto delta_segment = std::make_shared<DeltaEncodedSegment<int64_t>>(value_segment_long);
+  EXPECT_FALSE(delta_segment->is_sorted());
+  EXPECT_EQ(delta_segment->block_count(), 2);
+  EXPECT_EQ(delta_segment->checkpoints(), (std::vector<int64_t>{min, max}));
+  EXPECT_EQ(delta_segment->get(0), min);
+  EXPECT_EQ(delta_segment->get(BLOCK_SIZE - 1), min + BLOCK_SIZE - 1);
+  EXPECT_EQ(delta_segment->get(BLOCK_SIZE), max);
+  EXPECT_EQ(delta_segment->get(BLOCK_SIZE + 9), max - 9);
+}
+
+TEST_F(StorageDeltaEncodedSegmentTest, RejectsTooWideDeltas) {
+  value_segment_long->append(int64_t{0});
+  value_segment_long->append(int64_t{1} << 40);
+  EXPECT_THROW(std::make_shared<DeltaEncodedSegment<int64_t>>(value_segment_long), std::logic_error);
+}
+
+TEST_F(StorageDeltaEncodedSegmentTest, MemoryEstimation) {
+  for (auto index = 0; index < 640; ++index) {
+    value_segment_int->append(1'000'000 + index * 3);
+  }
+
+  const auto delta_segment = std::make_shared<DeltaEncodedSegment<int32_t>>(value_segment_int);
+  // Five checkpoints, 10 blocks of 64 two-bit deltas (2 words each), and 640 NULL flags.
+  EXPECT_EQ(delta_segment->estimate_memory_usage(), 5 * 4 + 10 * 2 * 8 + 640 / 8);
+}
+
+}  // namespace opossum
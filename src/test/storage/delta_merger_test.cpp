@@ -0,0 +1,66 @@
+#include "base_test.hpp"
+
+#include "storage/delta_merger.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/unsorted_dictionary_segment.hpp"
+
+namespace opossum {
+
+class StorageDeltaMergerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table->add_column("a", "int", false);
+    table->add_column("b", "string", true);
+    table->use_delta_store();
+  }
+
+  std::shared_ptr<Table> table{std::make_shared<Table>(10)};
+};
+
+TEST_F(StorageDeltaMergerTest, RequiresDeltaStore) {
+  EXPECT_THROW(DeltaMerger(std::make_shared<Table>(), std::chrono::milliseconds{1}), std::logic_error);
+}
+
+TEST_F(StorageDeltaMergerTest, MergeNow) {
+  auto merger = DeltaMerger(table, std::chrono::hours{1});
+  for (auto index = int32_t{0}; index < 25; ++index) {
+    table->append({index, std::to_string(index % 3)});
+  }
+
+  merger.merge_now();
+  EXPECT_EQ(merger.merged_chunk_count(), 2);
+  const auto main_segment = table->get_chunk(ChunkID{1})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(main_segment));
+  const auto delta_segment = table->get_chunk(ChunkID{2})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<UnsortedDictionarySegment<int32_t>>(delta_segment));
+}
+
+TEST_F(StorageDeltaMergerTest, MergesInBackgroundWhileAppending) {
+  auto merger = DeltaMerger(table, std::chrono::milliseconds{1});
+  for (auto index = int32_t{0}; index < 1'000; ++index) {
+    table->append({index, index % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{std::to_string(index % 5)}});
+  }
+
+  // Wait for the background thread to merge all full chunks.
+  for (auto attempt = 0; attempt < 1'000 && merger.merged_chunk_count() < 100; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+  }
+  ASSERT_EQ(merger.merged_chunk_count(), 100);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    ASSERT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk->get_segment(ColumnID{1})));
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto index = static_cast<int32_t>(chunk_id * 10 + chunk_offset);
+      EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{index});
+      if (index % 7 == 0) {
+        EXPECT_TRUE(variant_is_null((*chunk->get_segment(ColumnID{1}))[chunk_offset]));
+      } else {
+        EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{std::to_string(index % 5)});
+      }
+    }
+  }
+}
+
+}  // namespace opossum
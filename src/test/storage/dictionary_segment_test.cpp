@@ -3,7 +3,10 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_attribute_vector.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/bit_packed_integer_vector.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+#include "storage/resolve_attribute_vector.hpp"
 
 namespace opossum {
 
@@ -150,6 +153,53 @@ TEST_F(StorageDictionarySegmentTest, MemoryEstimation) {
   // 300 * 2 bytes for ValueIDs (2 bytes are needed for 300 distinct values)
   // 300 distinct values with 4 bytes for the uint32_t
   EXPECT_EQ(dict_segment_int->estimate_memory_usage(), 300 * 2 + 300 * 4);
+
+  value_segment_str->append("Bill");
+  value_segment_str->append("Steve");
+  value_segment_str->append("Bill");
+  const auto dict_segment_str = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
+
+  // 3 bytes for the ValueIDs, 9 characters, and 3 offsets with 4 bytes each.
+  EXPECT_EQ(dict_segment_str->estimate_memory_usage(), 3 * 1 + 9 + 3 * 4);
+}
+
+TEST_F(StorageDictionarySegmentTest, SharedDictionary) {
+  value_segment_str->append("Bill");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("Steve");
+  const auto other_value_segment = std::make_shared<ValueSegment<std::string>>();
+  other_value_segment->append("Alexander");
+  other_value_segment->append("Steve");
+  const auto other_dict_segment = std::make_shared<DictionarySegment<std::string>>(other_value_segment);
+
+  const auto dictionary =
+      DictionarySegment<std::string>::build_shared_dictionary({value_segment_str, other_dict_segment});
+  ASSERT_EQ(dictionary->size(), 3);
+  EXPECT_EQ((*dictionary)[0], "Alexander");
+  EXPECT_EQ((*dictionary)[2], "Steve");
+
+  const auto dict_segment = std::make_shared<DictionarySegment<std::string>>(value_segment_str, dictionary);
+  const auto remapped_dict_segment = std::make_shared<DictionarySegment<std::string>>(
+      other_dict_segment, dictionary, VectorCompressionType::BitPacking);
+  EXPECT_FALSE(other_dict_segment->has_shared_dictionary());
+  EXPECT_TRUE(dict_segment->has_shared_dictionary());
+  EXPECT_EQ(dict_segment->shared_dictionary(), remapped_dict_segment->shared_dictionary());
+
+  // The same values have the same ValueIDs in both segments.
+  EXPECT_EQ(dict_segment->attribute_vector()->get(2), ValueID{2});
+  EXPECT_EQ(remapped_dict_segment->attribute_vector()->get(0), ValueID{0});
+  EXPECT_EQ(remapped_dict_segment->attribute_vector()->get(1), ValueID{2});
+  EXPECT_EQ(dict_segment->attribute_vector()->get(1), dict_segment->null_value_id());
+  EXPECT_EQ(dict_segment->get(0), "Bill");
+  EXPECT_EQ(remapped_dict_segment->get(1), "Steve");
+  EXPECT_TRUE(variant_is_null((*dict_segment)[1]));
+
+  // The shared dictionary is not part of the memory usage of a segment.
+  EXPECT_EQ(dict_segment->estimate_memory_usage(), 3 * 1);
+
+  // All values have to be contained in the shared dictionary.
+  value_segment_str->append("Hasso");
+  EXPECT_THROW(std::make_shared<DictionarySegment<std::string>>(value_segment_str, dictionary), std::logic_error);
 }
 
 TEST_F(StorageDictionarySegmentTest, AttributeVectorWidth) {
@@ -187,4 +237,72 @@ TEST_F(StorageDictionarySegmentTest, AttributeVectorWidth) {
   EXPECT_EQ(dict_segment_string->attribute_vector()->width(), 2);
 }
 
+TEST_F(StorageDictionarySegmentTest, BitPackedAttributeVector) {
+  for (auto i = 0; i < 300; ++i) {
+    value_segment_int->append(i % 150);
+  }
+  value_segment_str->append("Bill");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("Steve");
+
+  const auto dict_segment_int =
+      std::make_shared<DictionarySegment<int32_t>>(value_segment_int, VectorCompressionType::BitPacking);
+  const auto dict_segment_str =
+      std::make_shared<DictionarySegment<std::string>>(value_segment_str, VectorCompressionType::BitPacking);
+
+  const auto bit_packed_int =
+      std::dynamic_pointer_cast<const BitPackedIntegerVector>(dict_segment_int->attribute_vector());
+  ASSERT_TRUE(bit_packed_int);
+  EXPECT_EQ(bit_packed_int->bit_width(), 8);
+
+  // Two distinct values and NULL need two bits.
+  const auto bit_packed_str =
+      std::dynamic_pointer_cast<const BitPackedIntegerVector>(dict_segment_str->attribute_vector());
+  ASSERT_TRUE(bit_packed_str);
+  EXPECT_EQ(bit_packed_str->bit_width(), 2);
+
+  for (auto i = 0; i < 300; ++i) {
+    EXPECT_EQ(dict_segment_int->get(i), i % 150);
+  }
+  EXPECT_EQ(dict_segment_str->get(0), "Bill");
+  EXPECT_EQ(dict_segment_str->get_typed_value(1), std::nullopt);
+  EXPECT_EQ(dict_segment_str->get(2), "Steve");
+
+  // 5 blocks of 64 values with 8 words each, 150 distinct values with 4 bytes each.
+  EXPECT_EQ(dict_segment_int->estimate_memory_usage(), 5 * 8 * 8 + 150 * 4);
+}
+
+
+TEST_F(StorageDictionarySegmentTest, DecodeAndResolveAttributeVector) {
+  for (auto i = 0; i < 100; ++i) {
+    value_segment_int->append(99 - i);
+  }
+
+  for (const auto vector_compression_type :
+       {VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking}) {
+    const auto dict_segment = std::make_shared<DictionarySegment<int32_t>>(value_segment_int, vector_compression_type);
+    const auto& attribute_vector = *dict_segment->attribute_vector();
+
+    auto value_ids = std::vector<ValueID>(70);
+    attribute_vector.decode(20, value_ids);
+    for (auto index = size_t{0}; index < value_ids.size(); ++index) {
+      EXPECT_EQ(value_ids[index], ValueID{static_cast<uint32_t>(79 - index)});
+    }
+
+    auto resolved_size = size_t{0};
+    resolve_attribute_vector(attribute_vector, [&](const auto& typed_attribute_vector) {
+      resolved_size = typed_attribute_vector.size();
+      EXPECT_EQ(typed_attribute_vector.get(0), ValueID{99});
+    });
+    EXPECT_EQ(resolved_size, 100);
+  }
+
+  const auto dict_segment = std::make_shared<DictionarySegment<int32_t>>(value_segment_int);
+  const auto fixed_width_vector =
+      std::dynamic_pointer_cast<const FixedWidthIntegerVector<uint8_t>>(dict_segment->attribute_vector());
+  ASSERT_TRUE(fixed_width_vector);
+  EXPECT_EQ(fixed_width_vector->values().size(), 100);
+  EXPECT_EQ(fixed_width_vector->values()[1], 98);
+}
+
 }  // namespace opossum
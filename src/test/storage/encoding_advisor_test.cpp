@@ -0,0 +1,81 @@
+#include <random>
+
+#include "base_test.hpp"
+
+#include "storage/delta_encoded_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StorageEncodingAdvisorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto random_engine = std::mt19937{42};
+    for (auto index = 0; index < 10'000; ++index) {
+      sorted_ids->append(1'000'000 + index);
+      // 100 distinct values that are spread over a wide range in random order.
+      low_cardinality_ints->append(static_cast<int32_t>(random_engine() % 100) * 1'000'003);
+      long_runs->append(index < 5000 ? "first long string value" : "second long string value");
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> sorted_ids{std::make_shared<ValueSegment<int32_t>>()};
+  std::shared_ptr<ValueSegment<int32_t>> low_cardinality_ints{std::make_shared<ValueSegment<int32_t>>()};
+  std::shared_ptr<ValueSegment<std::string>> long_runs{std::make_shared<ValueSegment<std::string>>(true)};
+};
+
+TEST_F(StorageEncodingAdvisorTest, RecommendsEncodingPerGoal) {
+  const auto minimum_memory = EncodingAdvisor{EncodingGoal::MinimumMemory};
+  const auto fastest_scan = EncodingAdvisor{EncodingGoal::FastestScan};
+  const auto balanced = EncodingAdvisor{};
+  EXPECT_EQ(balanced.goal(), EncodingGoal::Balanced);
+
+  // Increasing ids have a delta of one.
+  EXPECT_EQ(minimum_memory.recommend("int", sorted_ids).encoding_spec.encoding_type, EncodingType::Delta);
+  EXPECT_EQ(fastest_scan.recommend("int", sorted_ids).encoding_spec.encoding_type, EncodingType::Delta);
+
+  // Few distinct values without runs are dictionary-encoded, with bit-packed value ids if memory matters most.
+  const auto memory_spec = minimum_memory.recommend("int", low_cardinality_ints).encoding_spec;
+  EXPECT_EQ(memory_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(memory_spec.vector_compression_type, VectorCompressionType::BitPacking);
+  const auto scan_spec = fastest_scan.recommend("int", low_cardinality_ints).encoding_spec;
+  EXPECT_EQ(scan_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(scan_spec.vector_compression_type, VectorCompressionType::FixedWidthInteger);
+
+  // Two runs are stored in almost no memory and scanned with two comparisons.
+  EXPECT_EQ(minimum_memory.recommend("string", long_runs).encoding_spec.encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(balanced.recommend("string", long_runs).encoding_spec.encoding_type, EncodingType::RunLength);
+
+  EXPECT_THROW(balanced.recommend("string", sorted_ids), std::logic_error);
+}
+
+TEST_F(StorageEncodingAdvisorTest, CompressChunkWithAdvisor) {
+  auto table = Table{};
+  table.add_column("id", "int", false);
+  table.add_column("category", "int", false);
+  table.add_column("price", "float", true);
+  for (auto index = 0; index < 10'000; ++index) {
+    const auto price = index < 1000 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{1.5f};
+    table.append({index, (*low_cardinality_ints)[index], price});
+  }
+
+  const auto reports = table.compress_chunk(ChunkID{0}, EncodingAdvisor{EncodingGoal::MinimumMemory});
+  ASSERT_EQ(reports.size(), 3);
+  const auto chunk = table.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DeltaEncodedSegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{1})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<float>>(chunk->get_segment(ColumnID{2})));
+  EXPECT_EQ(reports[2].encoding_spec.encoding_type, EncodingType::RunLength);
+
+  // The properties these encodings depend on are computed exactly (the distinct count is exact as all distinct values
+  // appear in the sample), so the expected sizes are exact as well.
+  for (const auto& report : reports) {
+    EXPECT_EQ(report.expected_memory_usage, report.actual_memory_usage);
+    EXPECT_EQ(report.actual_memory_usage, chunk->get_segment(report.column_id)->estimate_memory_usage());
+  }
+}
+
+}  // namespace opossum
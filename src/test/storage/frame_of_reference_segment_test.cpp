@@ -0,0 +1,69 @@
+#include "base_test.hpp"
+
+#include "storage/frame_of_reference_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+  std::shared_ptr<ValueSegment<int64_t>> value_segment_long{std::make_shared<ValueSegment<int64_t>>()};
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegment) {
+  value_segment_int->append(1000);
+  value_segment_int->append(1003);
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(1001);
+
+  const auto for_segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(for_segment->size(), 4);
+  EXPECT_EQ(for_segment->block_minima(), std::vector<int32_t>{1000});
+  EXPECT_EQ(for_segment->offsets()->bit_width(), 2);
+  EXPECT_EQ(for_segment->offsets()->get(1), ValueID{3});
+
+  EXPECT_EQ(for_segment->get(0), 1000);
+  EXPECT_EQ(for_segment->get(1), 1003);
+  EXPECT_EQ(for_segment->get_typed_value(2), std::nullopt);
+  EXPECT_TRUE(variant_is_null((*for_segment)[2]));
+  EXPECT_EQ((*for_segment)[3], AllTypeVariant{1001});
+  EXPECT_THROW(for_segment->get(2), std::logic_error);
+  EXPECT_THROW(for_segment->get(4), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MultipleBlocksAndNegativeValues) {
+  constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<int64_t>::BLOCK_SIZE;
+  const auto base = std::numeric_limits<int64_t>::min();
+  for (auto index = int64_t{0}; index < BLOCK_SIZE; ++index) {
+    value_segment_long->append(base + index);
+  }
+  for (auto index = int64_t{0}; index < 10; ++index) {
+    value_segment_long->append(int64_t{-5} + index);
+  }
+
+  const auto for_segment = std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment_long);
+  EXPECT_EQ(for_segment->block_minima(), (std::vector<int64_t>{base, -5}));
+  EXPECT_EQ(for_segment->offsets()->bit_width(), 11);
+  EXPECT_EQ(for_segment->get(0), base);
+  EXPECT_EQ(for_segment->get(BLOCK_SIZE - 1), base + BLOCK_SIZE - 1);
+  EXPECT_EQ(for_segment->get(BLOCK_SIZE), -5);
+  EXPECT_EQ(for_segment->get(BLOCK_SIZE + 9), 4);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, RejectsTooWideBlocks) {
+  value_segment_long->append(int64_t{0});
+  value_segment_long->append(int64_t{1} << 40);
+  EXPECT_THROW(std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment_long), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MemoryEstimation) {
+  for (auto index = 0; index < 640; ++index) {
+    value_segment_int->append(1'000'000 + index % 16);
+  }
+
+  const auto for_segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment_int);
+  // One block minimum, 10 blocks of 64 four-bit offsets (4 words each), and 640 NULL flags.
+  EXPECT_EQ(for_segment->estimate_memory_usage(), 4 + 10 * 4 * 8 + 640 / 8);
+}
+
+}  // namespace opossum
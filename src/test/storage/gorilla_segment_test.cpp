@@ -0,0 +1,73 @@
+#include "base_test.hpp"
+
+#include "storage/gorilla_segment.hpp"
+
+namespace opossum {
+
+class StorageGorillaSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<double>> value_segment_double{std::make_shared<ValueSegment<double>>(true)};
+  std::shared_ptr<ValueSegment<float>> value_segment_float{std::make_shared<ValueSegment<float>>()};
+};
+
+TEST_F(StorageGorillaSegmentTest, CompressSegmentDouble) {
+  const auto values = std::vector<double>{12.0, 12.0, 24.0, -0.0, 3.141592653589793, 1e300,
+                                          std::numeric_limits<double>::infinity(), 12.5, 12.25};
+  for (const auto value : values) {
+    value_segment_double->append(value);
+  }
+  value_segment_double->append(NULL_VALUE);
+  value_segment_double->append(7.0);
+
+  const auto gorilla_segment = std::make_shared<GorillaSegment<double>>(value_segment_double);
+  EXPECT_EQ(gorilla_segment->size(), 11);
+  EXPECT_EQ(gorilla_segment->block_count(), 1);
+
+  for (auto index = ChunkOffset{0}; index < values.size(); ++index) {
+    EXPECT_EQ(gorilla_segment->get(index), values[index]);
+  }
+  EXPECT_TRUE(std::signbit(gorilla_segment->get(3)));
+  EXPECT_EQ(gorilla_segment->get_typed_value(9), std::nullopt);
+  EXPECT_TRUE(variant_is_null((*gorilla_segment)[9]));
+  EXPECT_EQ((*gorilla_segment)[10], AllTypeVariant{7.0});
+  EXPECT_THROW(gorilla_segment->get(9), std::logic_error);
+  EXPECT_THROW(gorilla_segment->get(11), std::logic_error);
+}
+
+TEST_F(StorageGorillaSegmentTest, DecodeBlocks) {
+  // Slowly changing sensor readings spanning several blocks.
+  auto expected_values = std::vector<float>{};
+  for (auto index = 0; index < 2500; ++index) {
+    expected_values.emplace_back(20.0f + static_cast<float>(index % 100) * 0.25f);
+    value_segment_float->append(expected_values.back());
+  }
+
+  const auto gorilla_segment = std::make_shared<GorillaSegment<float>>(value_segment_float);
+  ASSERT_EQ(gorilla_segment->block_count(), 3);
+
+  auto block = std::vector<float>(GorillaSegment<float>::BLOCK_SIZE);
+  for (auto block_index = size_t{0}; block_index < gorilla_segment->block_count(); ++block_index) {
+    gorilla_segment->decode_block(block_index, block);
+    const auto block_begin = block_index * GorillaSegment<float>::BLOCK_SIZE;
+    const auto block_end = std::min(block_begin + GorillaSegment<float>::BLOCK_SIZE, expected_values.size());
+    for (auto index = block_begin; index < block_end; ++index) {
+      EXPECT_EQ(block[index - block_begin], expected_values[index]);
+    }
+  }
+
+  EXPECT_THROW(gorilla_segment->decode_block(3, block), std::logic_error);
+  EXPECT_LT(gorilla_segment->estimate_memory_usage(), value_segment_float->estimate_memory_usage());
+}
+
+TEST_F(StorageGorillaSegmentTest, RepeatedValuesNeedOneBitEach) {
+  for (auto index = 0; index < 1024; ++index) {
+    value_segment_float->append(42.0f);
+  }
+
+  const auto gorilla_segment = std::make_shared<GorillaSegment<float>>(value_segment_float);
+  // 32 bits for the first value, one bit for each of the 1023 repetitions, rounded up to 17 words, plus the offset of
+  // the single block.
+  EXPECT_EQ(gorilla_segment->estimate_memory_usage(), 17 * 8 + 8);
+}
+
+}  // namespace opossum
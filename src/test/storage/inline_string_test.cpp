@@ -0,0 +1,66 @@
+#include <algorithm>
+
+#include "base_test.hpp"
+
+#include "storage/inline_string.hpp"
+
+namespace opossum {
+
+class StorageInlineStringTest : public BaseTest {};
+
+TEST_F(StorageInlineStringTest, InlinedAndReferencedStrings) {
+  const auto short_string = std::string{"Hello world!"};
+  const auto long_string = std::string{"Hello wonderful world!"};
+
+  const auto inlined = InlineString{short_string};
+  EXPECT_TRUE(inlined.is_inlined());
+  EXPECT_EQ(inlined.size(), 12);
+  EXPECT_EQ(std::string_view{inlined}, short_string);
+  EXPECT_NE(inlined.data(), short_string.data());
+
+  const auto referenced = InlineString{long_string};
+  EXPECT_FALSE(referenced.is_inlined());
+  EXPECT_EQ(std::string_view{referenced}, long_string);
+  EXPECT_EQ(referenced.data(), long_string.data());
+
+  EXPECT_EQ(std::string_view{InlineString{}}, "");
+}
+
+TEST_F(StorageInlineStringTest, Comparison) {
+  const auto strings = std::vector<std::string>{"",        "a",           std::string{"a\0", 2}, "ab",
+                                                "abcd",    "abcde",       "abcdefghijklm",       "abcdefghijklmn",
+                                                "abcdefz", "abce",        "b",                   "\xff"};
+  for (const auto& lhs : strings) {
+    for (const auto& rhs : strings) {
+      const auto inline_lhs = InlineString{lhs};
+      const auto inline_rhs = InlineString{rhs};
+      EXPECT_EQ(inline_lhs == inline_rhs, lhs == rhs) << lhs << " == " << rhs;
+      EXPECT_EQ(inline_lhs < inline_rhs, lhs < rhs) << lhs << " < " << rhs;
+      EXPECT_EQ(inline_lhs == std::string_view{rhs}, lhs == rhs) << lhs << " == " << rhs;
+      EXPECT_EQ(inline_lhs > std::string_view{rhs}, lhs > rhs) << lhs << " > " << rhs;
+    }
+  }
+}
+
+TEST_F(StorageInlineStringTest, Arena) {
+  auto arena = StringArena{};
+  const auto inlined = arena.store("short");
+  EXPECT_TRUE(inlined.is_inlined());
+  EXPECT_EQ(arena.estimate_memory_usage(), 0);
+
+  auto long_string = std::string{"a string that does not fit into an InlineString"};
+  const auto stored = arena.store(long_string);
+  long_string.assign(long_string.size(), 'x');
+  EXPECT_EQ(std::string_view{stored}, "a string that does not fit into an InlineString");
+  EXPECT_EQ(arena.estimate_memory_usage(), 1024);
+
+  // Strings that do not fit into the current block get a new block. Previously stored strings stay valid, also when
+  // the arena is moved.
+  const auto huge = arena.store(std::string(5000, 'y'));
+  const auto moved_arena = std::move(arena);
+  EXPECT_EQ(std::string_view{huge}, std::string(5000, 'y'));
+  EXPECT_EQ(std::string_view{stored}, "a string that does not fit into an InlineString");
+  EXPECT_EQ(moved_arena.estimate_memory_usage(), 1024 + 5000);
+}
+
+}  // namespace opossum
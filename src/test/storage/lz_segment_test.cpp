@@ -0,0 +1,70 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/lz_segment.hpp"
+
+namespace opossum {
+
+class StorageLZSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>()};
+  std::shared_ptr<ValueSegment<std::string>> value_segment_str{std::make_shared<ValueSegment<std::string>>(true)};
+};
+
+TEST_F(StorageLZSegmentTest, CompressSegmentString) {
+  value_segment_str->append("Bill");
+  value_segment_str->append("");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("Steve");
+
+  const auto lz_segment = std::make_shared<LZSegment<std::string>>(value_segment_str);
+  EXPECT_EQ(lz_segment->size(), 4);
+  EXPECT_EQ(lz_segment->block_count(), 1);
+  EXPECT_EQ(lz_segment->get(0), "Bill");
+  EXPECT_EQ(lz_segment->get(1), "");
+  EXPECT_EQ(lz_segment->get_typed_value(2), std::nullopt);
+  EXPECT_TRUE(variant_is_null((*lz_segment)[2]));
+  EXPECT_EQ((*lz_segment)[3], AllTypeVariant{"Steve"});
+  EXPECT_THROW(lz_segment->get(2), std::logic_error);
+  EXPECT_THROW(lz_segment->get(4), std::logic_error);
+}
+
+TEST_F(StorageLZSegmentTest, CompressDictionarySegment) {
+  value_segment_str->append("Hasso");
+  value_segment_str->append(NULL_VALUE);
+  const auto dictionary_segment = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
+
+  const auto lz_segment = std::make_shared<LZSegment<std::string>>(dictionary_segment);
+  EXPECT_TRUE(lz_segment->is_nullable());
+  EXPECT_EQ(lz_segment->null_values(), (Bitmap{false, true}));
+  EXPECT_EQ(lz_segment->get(0), "Hasso");
+
+  EXPECT_THROW(std::make_shared<LZSegment<int32_t>>(dictionary_segment), std::logic_error);
+}
+
+TEST_F(StorageLZSegmentTest, BlocksAndCache) {
+  for (auto index = 0; index < 10'000; ++index) {
+    value_segment_int->append(index % 7);
+  }
+
+  const auto lz_segment = std::make_shared<LZSegment<int32_t>>(value_segment_int);
+  ASSERT_EQ(lz_segment->block_count(), 3);
+  EXPECT_FALSE(lz_segment->is_nullable());
+  EXPECT_LT(lz_segment->estimate_memory_usage(), value_segment_int->estimate_memory_usage() / 10);
+
+  for (auto index = ChunkOffset{0}; index < 10'000; index += 997) {
+    EXPECT_EQ(lz_segment->get(index), static_cast<int32_t>(index % 7));
+  }
+
+  // Accessing the same block again returns the cached decompressed values.
+  const auto block = lz_segment->decompressed_block(2);
+  EXPECT_EQ(block->size(), 10'000 - 2 * LZSegment<int32_t>::BLOCK_SIZE);
+  EXPECT_EQ(lz_segment->decompressed_block(2), block);
+
+  // Another segment does not hit the cached blocks of the first one.
+  const auto other_lz_segment = std::make_shared<LZSegment<int32_t>>(value_segment_int);
+  EXPECT_NE(other_lz_segment->decompressed_block(2), block);
+  EXPECT_EQ(*other_lz_segment->decompressed_block(2), *block);
+}
+
+}  // namespace opossum
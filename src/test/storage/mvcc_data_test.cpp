@@ -0,0 +1,109 @@
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "storage/mvcc_data.hpp"
+
+namespace opossum {
+
+class StorageMvccDataTest : public BaseTest {
+ protected:
+  MvccData mvcc_data;
+};
+
+TEST_F(StorageMvccDataTest, Grow) {
+  EXPECT_EQ(mvcc_data.size(), 0);
+  mvcc_data.grow(3);
+  EXPECT_EQ(mvcc_data.size(), 3);
+  EXPECT_EQ(mvcc_data.begin_commit_id(2), MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data.end_commit_id(2), MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data.transaction_id(2), INVALID_TRANSACTION_ID);
+
+  // Rows do not move when the data grows across blocks.
+  mvcc_data.set_begin_commit_id(1, 7);
+  const auto memory_usage = mvcc_data.estimate_memory_usage();
+  mvcc_data.grow(100'000);
+  mvcc_data.grow(10);
+  EXPECT_EQ(mvcc_data.size(), 100'000);
+  EXPECT_EQ(mvcc_data.begin_commit_id(1), 7);
+  EXPECT_EQ(mvcc_data.begin_commit_id(99'999), MAX_COMMIT_ID);
+  EXPECT_GT(mvcc_data.estimate_memory_usage(), memory_usage);
+}
+
+TEST_F(StorageMvccDataTest, CompareExchangeTransactionID) {
+  mvcc_data.grow(1);
+  auto expected = INVALID_TRANSACTION_ID;
+  EXPECT_TRUE(mvcc_data.compare_exchange_transaction_id(0, expected, 5));
+  EXPECT_FALSE(mvcc_data.compare_exchange_transaction_id(0, expected, 6));
+  EXPECT_EQ(expected, 5);
+  EXPECT_EQ(mvcc_data.transaction_id(0), 5);
+}
+
+TEST_F(StorageMvccDataTest, Visibility) {
+  mvcc_data.grow(5);
+  // Row 0 was committed at 2, row 1 was committed at 2 and deleted at 4.
+  mvcc_data.set_begin_commit_id(0, 2);
+  mvcc_data.set_begin_commit_id(1, 2);
+  mvcc_data.set_end_commit_id(1, 4);
+  // Row 2 is being inserted by transaction 10, row 3 is being deleted by it.
+  mvcc_data.set_transaction_id(2, 10);
+  mvcc_data.set_begin_commit_id(3, 1);
+  mvcc_data.set_transaction_id(3, 10);
+  // Row 4 was inserted by a transaction that was rolled back.
+
+  EXPECT_FALSE(mvcc_data.is_visible(0, 11, 1));
+  EXPECT_TRUE(mvcc_data.is_visible(0, 11, 2));
+  EXPECT_TRUE(mvcc_data.is_visible(1, 11, 3));
+  EXPECT_FALSE(mvcc_data.is_visible(1, 11, 4));
+
+  EXPECT_TRUE(mvcc_data.is_visible(2, 10, 3));
+  EXPECT_FALSE(mvcc_data.is_visible(2, 11, 3));
+  EXPECT_FALSE(mvcc_data.is_visible(3, 10, 3));
+  EXPECT_TRUE(mvcc_data.is_visible(3, 11, 3));
+
+  EXPECT_FALSE(mvcc_data.is_visible(4, 11, 3));
+  EXPECT_FALSE(mvcc_data.is_visible(4, INVALID_TRANSACTION_ID, 3));
+  EXPECT_FALSE(mvcc_data.is_visible(5, 11, 3));
+
+  auto other_mvcc_data = MvccData{};
+  other_mvcc_data.grow(1);
+  other_mvcc_data.copy_row(0, mvcc_data, 1);
+  EXPECT_EQ(other_mvcc_data.begin_commit_id(0), 2);
+  EXPECT_EQ(other_mvcc_data.end_commit_id(0), 4);
+}
+
+TEST_F(StorageMvccDataTest, Invalidate) {
+  mvcc_data.grow(2'000);
+  EXPECT_EQ(mvcc_data.invalidated_row_count(), 0);
+  mvcc_data.invalidate(3);
+  mvcc_data.invalidate(1'500);
+  mvcc_data.invalidate(3);
+  EXPECT_EQ(mvcc_data.invalidated_row_count(), 2);
+  EXPECT_TRUE(mvcc_data.is_invalidated(3));
+  EXPECT_TRUE(mvcc_data.is_invalidated(1'500));
+  EXPECT_FALSE(mvcc_data.is_invalidated(4));
+  EXPECT_FALSE(mvcc_data.is_invalidated(1'499));
+}
+
+TEST_F(StorageMvccDataTest, ConcurrentGrowAndRead) {
+  constexpr auto ROW_COUNT = ChunkOffset{200'000};
+  auto writer = std::thread([&]() {
+    for (auto size = ChunkOffset{1}; size <= ROW_COUNT; ++size) {
+      mvcc_data.grow(size);
+      mvcc_data.set_begin_commit_id(size - 1, size);
+    }
+  });
+
+  // Readers see all rows up to the published size, with their commit id either not yet set or set.
+  while (mvcc_data.size() < ROW_COUNT) {
+    const auto size = mvcc_data.size();
+    if (size > 0) {
+      const auto begin_commit_id = mvcc_data.begin_commit_id(size - 1);
+      EXPECT_TRUE(begin_commit_id == MAX_COMMIT_ID || begin_commit_id == size);
+    }
+  }
+  writer.join();
+  EXPECT_EQ(mvcc_data.begin_commit_id(ROW_COUNT - 1), ROW_COUNT);
+}
+
+}  // namespace opossum
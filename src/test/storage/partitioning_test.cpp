@@ -0,0 +1,68 @@
+#include "base_test.hpp"
+
+#include "storage/partitioning.hpp"
+
+namespace opossum {
+
+class StoragePartitioningTest : public BaseTest {};
+
+TEST_F(StoragePartitioningTest, HashPartitioning) {
+  const auto partitioning = HashPartitioning<int32_t>{ColumnID{1}, PartitionID{4}};
+  EXPECT_EQ(partitioning.column_id(), ColumnID{1});
+  EXPECT_EQ(partitioning.partition_count(), 4);
+  EXPECT_EQ(partitioning.partition(NULL_VALUE), PartitionID{0});
+
+  // Consecutive values are spread over all partitions.
+  auto row_counts = std::vector<size_t>(4);
+  for (auto value = int32_t{0}; value < 400; ++value) {
+    const auto partition_id = partitioning.partition(value);
+    ASSERT_LT(partition_id, 4);
+    EXPECT_EQ(partitioning.partition(int64_t{value}), partition_id);
+    ++row_counts[partition_id];
+  }
+  for (const auto row_count : row_counts) {
+    EXPECT_GT(row_count, 50);
+  }
+
+  // Only equality predicates can exclude partitions.
+  const auto partition_id = partitioning.partition(7);
+  for (auto other_partition_id = PartitionID{0}; other_partition_id < 4; ++other_partition_id) {
+    EXPECT_EQ(partitioning.may_match(other_partition_id, ScanType::OpEquals, 7), other_partition_id == partition_id);
+    EXPECT_TRUE(partitioning.may_match(other_partition_id, ScanType::OpLessThan, 7));
+    EXPECT_FALSE(partitioning.may_match(other_partition_id, ScanType::OpNotEquals, NULL_VALUE));
+  }
+
+  EXPECT_THROW((HashPartitioning<int32_t>{ColumnID{0}, PartitionID{0}}), std::logic_error);
+}
+
+TEST_F(StoragePartitioningTest, RangePartitioning) {
+  // Partitions: (-inf, "f"), ["f", "m"), ["m", inf).
+  const auto partitioning = RangePartitioning<std::string>{ColumnID{0}, {"f", "m"}};
+  EXPECT_EQ(partitioning.partition_count(), 3);
+  EXPECT_EQ(partitioning.bounds(), (std::vector<std::string>{"f", "m"}));
+  EXPECT_EQ(partitioning.partition(NULL_VALUE), PartitionID{0});
+  EXPECT_EQ(partitioning.partition("a"), PartitionID{0});
+  EXPECT_EQ(partitioning.partition("f"), PartitionID{1});
+  EXPECT_EQ(partitioning.partition("lz"), PartitionID{1});
+  EXPECT_EQ(partitioning.partition("m"), PartitionID{2});
+  EXPECT_EQ(partitioning.partition("z"), PartitionID{2});
+
+  const auto may_match = [&](const ScanType scan_type, const std::string& search_value) {
+    auto matches = std::vector<bool>{};
+    for (auto partition_id = PartitionID{0}; partition_id < 3; ++partition_id) {
+      matches.emplace_back(partitioning.may_match(partition_id, scan_type, search_value));
+    }
+    return matches;
+  };
+  EXPECT_EQ(may_match(ScanType::OpEquals, "g"), (std::vector<bool>{false, true, false}));
+  EXPECT_EQ(may_match(ScanType::OpNotEquals, "g"), (std::vector<bool>{true, true, true}));
+  EXPECT_EQ(may_match(ScanType::OpLessThan, "f"), (std::vector<bool>{true, false, false}));
+  EXPECT_EQ(may_match(ScanType::OpLessThanEquals, "f"), (std::vector<bool>{true, true, false}));
+  EXPECT_EQ(may_match(ScanType::OpGreaterThan, "m"), (std::vector<bool>{false, false, true}));
+  EXPECT_EQ(may_match(ScanType::OpGreaterThanEquals, "e"), (std::vector<bool>{true, true, true}));
+
+  EXPECT_THROW((RangePartitioning<int32_t>{ColumnID{0}, {5, 5}}), std::logic_error);
+  EXPECT_THROW((RangePartitioning<int32_t>{ColumnID{0}, {NULL_VALUE}}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#include "base_test.hpp"
+
+#include "storage/run_length_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>()};
+  std::shared_ptr<ValueSegment<std::string>> value_segment_str{std::make_shared<ValueSegment<std::string>>(true)};
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentString) {
+  value_segment_str->append("Bill");
+  value_segment_str->append("Bill");
+  value_segment_str->append("Steve");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("Bill");
+
+  const auto rle_segment = std::make_shared<RunLengthSegment<std::string>>(value_segment_str);
+
+  EXPECT_EQ(rle_segment->size(), 6);
+  EXPECT_EQ(rle_segment->run_count(), 4);
+  EXPECT_EQ(rle_segment->values(), (std::vector<std::string>{"Bill", "Steve", "", "Bill"}));
+  EXPECT_EQ(rle_segment->null_values(), (Bitmap{false, false, true, false}));
+  EXPECT_EQ(rle_segment->end_positions(), (std::vector<ChunkOffset>{1, 2, 4, 5}));
+
+  EXPECT_EQ(rle_segment->get(0), "Bill");
+  EXPECT_EQ(rle_segment->get(1), "Bill");
+  EXPECT_EQ(rle_segment->get(2), "Steve");
+  EXPECT_EQ(rle_segment->get_typed_value(3), std::nullopt);
+  EXPECT_TRUE(variant_is_null((*rle_segment)[4]));
+  EXPECT_EQ((*rle_segment)[5], AllTypeVariant{"Bill"});
+  EXPECT_THROW(rle_segment->get(3), std::logic_error);
+  EXPECT_THROW(rle_segment->get(6), std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(rle_segment->size(), 0);
+  EXPECT_EQ(rle_segment->run_count(), 0);
+}
+
+TEST_F(StorageRunLengthSegmentTest, RejectsOtherSegmentTypes) {
+  EXPECT_THROW(std::make_shared<RunLengthSegment<int64_t>>(value_segment_int), std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, MemoryEstimation) {
+  for (auto i = 0; i < 1000; ++i) {
+    value_segment_int->append(i / 250);
+  }
+
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(rle_segment->run_count(), 4);
+  // 4 runs with 4 bytes for the value, 4 bytes for the end position, and one bit for the NULL flag (one word).
+  EXPECT_EQ(rle_segment->estimate_memory_usage(), 4 * 4 + 4 * 4 + 8);
+}
+
+}  // namespace opossum
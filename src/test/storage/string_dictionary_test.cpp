@@ -0,0 +1,45 @@
+#include <algorithm>
+
+#include "base_test.hpp"
+
+#include "storage/string_dictionary.hpp"
+
+namespace opossum {
+
+class StorageStringDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    dictionary.reserve(4, 14);
+    dictionary.emplace_back("");
+    dictionary.emplace_back("Alexander");
+    dictionary.emplace_back("Bill");
+    dictionary.emplace_back("Hasso");
+  }
+
+  StringDictionary dictionary;
+};
+
+TEST_F(StorageStringDictionaryTest, Access) {
+  EXPECT_EQ(dictionary.size(), 4);
+  EXPECT_FALSE(dictionary.empty());
+  EXPECT_EQ(dictionary[0], "");
+  EXPECT_EQ(dictionary[1], "Alexander");
+  EXPECT_EQ(dictionary[2], "Bill");
+  EXPECT_EQ(dictionary[3], "Hasso");
+  EXPECT_TRUE(StringDictionary{}.empty());
+}
+
+TEST_F(StorageStringDictionaryTest, BinarySearch) {
+  EXPECT_EQ(std::lower_bound(dictionary.begin(), dictionary.end(), "Bill") - dictionary.begin(), 2);
+  EXPECT_EQ(std::upper_bound(dictionary.begin(), dictionary.end(), "Bill") - dictionary.begin(), 3);
+  EXPECT_EQ(std::lower_bound(dictionary.begin(), dictionary.end(), "Ba") - dictionary.begin(), 2);
+  EXPECT_EQ(std::lower_bound(dictionary.begin(), dictionary.end(), "Z"), dictionary.end());
+  EXPECT_EQ(std::distance(dictionary.begin(), dictionary.end()), 4);
+}
+
+TEST_F(StorageStringDictionaryTest, MemoryEstimation) {
+  // 18 characters and five 4-byte offsets.
+  EXPECT_EQ(dictionary.estimate_memory_usage(), 18 + 5 * 4);
+}
+
+}  // namespace opossum
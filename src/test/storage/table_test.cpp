@@ -1,6 +1,18 @@
+#include <thread>
+
 #include "base_test.hpp"
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "storage/bit_packed_integer_vector.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/column_batch.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/partitioning.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
+#include "storage/unsorted_dictionary_segment.hpp"
 
 namespace opossum {
 
@@ -124,4 +136,463 @@ TEST_F(StorageTableTest, AppendWithEncodedSegments) {
   EXPECT_EQ(table.chunk_count(), 3);
 }
 
+
+TEST_F(StorageTableTest, CompressChunkWithEncodingSpecs) {
+  table.append({1, "foo"});
+  table.append({1, NULL_VALUE});
+  table.append({2, "bar"});
+
+  table.compress_chunk(ChunkID{0}, SegmentEncodingSpec{EncodingType::RunLength});
+  const auto chunk = table.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<std::string>>(chunk->get_segment(ColumnID{1})));
+
+  table.compress_chunk(ChunkID{1}, {SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{}});
+  const auto mixed_chunk = table.get_chunk(ChunkID{1});
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(mixed_chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(mixed_chunk->get_segment(ColumnID{1})));
+  EXPECT_EQ((*mixed_chunk->get_segment(ColumnID{1}))[0], AllTypeVariant{"bar"});
+
+  EXPECT_THROW(table.compress_chunk(ChunkID{0}, std::vector<SegmentEncodingSpec>{}), std::logic_error);
+
+  // Errors during the encoding of a column are passed on to the caller.
+  table.append({3, "baz"});
+  EXPECT_THROW(table.compress_chunk(ChunkID{2}, SegmentEncodingSpec{EncodingType::FrameOfReference}),
+               std::logic_error);
+}
+
+TEST_F(StorageTableTest, UseGlobalDictionary) {
+  table.append({4, "Hello,"});
+  table.append({6, "world"});
+  table.append({3, "!"});
+  table.append({4, "world"});
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1}, SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking});
+
+  EXPECT_FALSE(table.uses_global_dictionary(ColumnID{1}));
+  table.use_global_dictionary(ColumnID{1});
+  EXPECT_TRUE(table.uses_global_dictionary(ColumnID{1}));
+  EXPECT_FALSE(table.uses_global_dictionary(ColumnID{0}));
+
+  const auto dictionary_segment = [&](const ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+        table.get_chunk(chunk_id)->get_segment(ColumnID{1}));
+  };
+  const auto dictionary = dictionary_segment(ChunkID{0})->shared_dictionary();
+  EXPECT_EQ(dictionary->size(), 3);
+  EXPECT_EQ(dictionary_segment(ChunkID{1})->shared_dictionary(), dictionary);
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<const BitPackedIntegerVector>(dictionary_segment(ChunkID{1})->attribute_vector()));
+  EXPECT_EQ(dictionary_segment(ChunkID{0})->attribute_vector()->get(1),
+            dictionary_segment(ChunkID{1})->attribute_vector()->get(1));
+  const auto int_segment = table.get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_FALSE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(int_segment)->has_shared_dictionary());
+
+  // New chunks reuse the dictionary if it contains all of their values.
+  table.append({5, "!"});
+  table.append({5, NULL_VALUE});
+  table.compress_chunk(ChunkID{2});
+  EXPECT_EQ(dictionary_segment(ChunkID{2})->shared_dictionary(), dictionary);
+
+  // Otherwise, the dictionary is rebuilt and all segments of the column are re-encoded.
+  table.append({7, "Hallo"});
+  table.compress_chunk(ChunkID{3});
+  const auto rebuilt_dictionary = dictionary_segment(ChunkID{3})->shared_dictionary();
+  EXPECT_NE(rebuilt_dictionary, dictionary);
+  EXPECT_EQ(rebuilt_dictionary->size(), 4);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    EXPECT_EQ(dictionary_segment(chunk_id)->shared_dictionary(), rebuilt_dictionary);
+  }
+  EXPECT_EQ((*table.get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+  EXPECT_EQ((*table.get_chunk(ChunkID{1})->get_segment(ColumnID{1}))[0], AllTypeVariant{"!"});
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<const BitPackedIntegerVector>(dictionary_segment(ChunkID{1})->attribute_vector()));
+
+  // Columns with a global dictionary cannot use other encodings.
+  table.append({8, "world"});
+  EXPECT_THROW(table.compress_chunk(ChunkID{4}, SegmentEncodingSpec{EncodingType::RunLength}), std::logic_error);
+  EXPECT_THROW(table.use_global_dictionary(ColumnID{2}), std::logic_error);
+
+  // Columns with segments of other encodings cannot use a global dictionary. They are left unchanged.
+  table.compress_chunk(ChunkID{4}, std::vector<SegmentEncodingSpec>{SegmentEncodingSpec{EncodingType::RunLength},
+                                                                    SegmentEncodingSpec{}});
+  EXPECT_THROW(table.use_global_dictionary(ColumnID{0}), std::logic_error);
+  EXPECT_FALSE(table.uses_global_dictionary(ColumnID{0}));
+  table.append({9, "!"});
+  table.compress_chunk(ChunkID{5}, std::vector<SegmentEncodingSpec>{SegmentEncodingSpec{EncodingType::RunLength},
+                                                                    SegmentEncodingSpec{}});
+  EXPECT_EQ((*table.get_chunk(ChunkID{5})->get_segment(ColumnID{0}))[0], AllTypeVariant{9});
+}
+
+TEST_F(StorageTableTest, GlobalDictionaryWithConcurrentCompression) {
+  auto global_dictionary_table = Table{10};
+  global_dictionary_table.add_column("a", "int", false);
+  global_dictionary_table.use_global_dictionary(ColumnID{0});
+  for (auto value = int32_t{0}; value < 160; ++value) {
+    global_dictionary_table.append({value});
+  }
+
+  // Each compressed chunk rebuilds the dictionary. All chunks end up with the same one nevertheless.
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = uint32_t{0}; thread_index < 4; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto chunk_id = ChunkID{thread_index}; chunk_id < 16; chunk_id += 4) {
+        global_dictionary_table.compress_chunk(chunk_id);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto dictionary_segment = [&](const ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+        global_dictionary_table.get_chunk(chunk_id)->get_segment(ColumnID{0}));
+  };
+  const auto dictionary = dictionary_segment(ChunkID{0})->shared_dictionary();
+  EXPECT_EQ(dictionary->size(), 160);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 16; ++chunk_id) {
+    EXPECT_EQ(dictionary_segment(chunk_id)->shared_dictionary(), dictionary);
+    EXPECT_EQ(dictionary_segment(chunk_id)->get(ChunkOffset{3}), static_cast<int32_t>(chunk_id * 10 + 3));
+  }
+}
+
+TEST_F(StorageTableTest, DeltaStore) {
+  EXPECT_FALSE(table.uses_delta_store());
+  EXPECT_THROW(table.merge_delta(), std::logic_error);
+  table.use_delta_store(SegmentEncodingSpec{EncodingType::RunLength});
+  EXPECT_TRUE(table.uses_delta_store());
+
+  table.append({4, "Hello,"});
+  table.append({6, NULL_VALUE});
+  table.append({3, "!"});
+  const auto delta_segment = table.get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<UnsortedDictionarySegment<int32_t>>(delta_segment));
+
+  // Only full delta chunks are merged.
+  EXPECT_EQ(table.merge_delta(), (std::vector<ChunkID>{ChunkID{0}}));
+  EXPECT_TRUE(table.merge_delta().empty());
+  const auto main_chunk = table.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<std::string>>(main_chunk->get_segment(ColumnID{1})));
+  EXPECT_TRUE(variant_is_null((*main_chunk->get_segment(ColumnID{1}))[1]));
+  EXPECT_EQ((*main_chunk->get_segment(ColumnID{0}))[0], AllTypeVariant{4});
+
+  // Rows are appended to the delta chunk, merged chunks are not changed anymore.
+  table.append({7, "world"});
+  EXPECT_EQ(table.chunk_count(), 2);
+  EXPECT_EQ(table.merge_delta(), (std::vector<ChunkID>{ChunkID{1}}));
+  table.append({8, "again"});
+  EXPECT_EQ(table.chunk_count(), 3);
+  EXPECT_EQ(table.row_count(), 5);
+
+  EXPECT_THROW(table.use_delta_store(), std::logic_error);
+}
+
+TEST_F(StorageTableTest, ZoneMaps) {
+  table.append({4, "Hello,"});
+  table.append({6, NULL_VALUE});
+  table.append({3, "!"});
+
+  const auto zone_map =
+      std::dynamic_pointer_cast<ZoneMap<int32_t>>(table.get_chunk(ChunkID{0})->get_zone_map(ColumnID{0}));
+  ASSERT_TRUE(zone_map);
+  EXPECT_EQ(zone_map->zone().min, 4);
+  EXPECT_EQ(zone_map->zone().max, 6);
+  EXPECT_EQ(zone_map->block_size(), 0);
+
+  // The zone maps are kept when the chunk is compressed.
+  table.compress_chunk(ChunkID{0});
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->get_zone_map(ColumnID{0}), zone_map);
+  const auto string_zone_map =
+      std::dynamic_pointer_cast<ZoneMap<std::string>>(table.get_chunk(ChunkID{0})->get_zone_map(ColumnID{1}));
+  ASSERT_TRUE(string_zone_map);
+  EXPECT_EQ(string_zone_map->zone().null_count, 1);
+}
+
+TEST_F(StorageTableTest, UseBlockZoneMaps) {
+  EXPECT_EQ(table.zone_map_block_size(), 0);
+  EXPECT_THROW(table.use_block_zone_maps(0), std::logic_error);
+  table.use_block_zone_maps(1);
+  EXPECT_EQ(table.zone_map_block_size(), 1);
+
+  table.append({4, "Hello,"});
+  table.append({6, "world"});
+  const auto zone_map =
+      std::dynamic_pointer_cast<ZoneMap<int32_t>>(table.get_chunk(ChunkID{0})->get_zone_map(ColumnID{0}));
+  ASSERT_EQ(zone_map->block_zones().size(), 2);
+  EXPECT_EQ(zone_map->block_zones()[1].min, 6);
+
+  EXPECT_THROW(table.use_block_zone_maps(), std::logic_error);
+}
+
+TEST_F(StorageTableTest, UseBloomFilter) {
+  table.append({4, "Hello,"});
+  table.append({6, "world"});
+  table.append({3, "!"});
+  table.compress_chunk(ChunkID{0});
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->get_bloom_filter(ColumnID{1}));
+
+  // Filters are built for immutable chunks right away and for other chunks when they are compressed.
+  EXPECT_FALSE(table.uses_bloom_filter(ColumnID{1}));
+  table.use_bloom_filter(ColumnID{1});
+  EXPECT_TRUE(table.uses_bloom_filter(ColumnID{1}));
+  const auto bloom_filter = table.get_chunk(ChunkID{0})->get_bloom_filter(ColumnID{1});
+  ASSERT_TRUE(bloom_filter);
+  EXPECT_TRUE(bloom_filter->may_contain(std::string{"world"}));
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->get_bloom_filter(ColumnID{0}));
+  EXPECT_FALSE(table.get_chunk(ChunkID{1})->get_bloom_filter(ColumnID{1}));
+
+  table.compress_chunk(ChunkID{1});
+  ASSERT_TRUE(table.get_chunk(ChunkID{1})->get_bloom_filter(ColumnID{1}));
+  EXPECT_TRUE(table.get_chunk(ChunkID{1})->get_bloom_filter(ColumnID{1})->may_contain(std::string{"!"}));
+
+  // Re-encoding the segments with a global dictionary keeps their filters.
+  table.use_global_dictionary(ColumnID{1});
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->get_bloom_filter(ColumnID{1}), bloom_filter);
+}
+
+TEST_F(StorageTableTest, DetectSortMode) {
+  auto sorted_table = Table{4};
+  sorted_table.add_column("a", "int", true);
+  sorted_table.add_column("b", "string", true);
+  sorted_table.add_column("c", "int", false);
+  sorted_table.add_column("d", "int", true);
+  sorted_table.append({NULL_VALUE, "d", 1, 1});
+  sorted_table.append({1, "c", 1, NULL_VALUE});
+  sorted_table.append({1, NULL_VALUE, 1, 2});
+  sorted_table.append({3, NULL_VALUE, 1, NULL_VALUE});
+  sorted_table.compress_chunk(ChunkID{0});
+
+  const auto chunk = sorted_table.get_chunk(ChunkID{0});
+  EXPECT_EQ(chunk->sort_mode(ColumnID{0}), SortMode::AscendingNullsFirst);
+  EXPECT_EQ(chunk->sort_mode(ColumnID{1}), SortMode::DescendingNullsLast);
+  EXPECT_EQ(chunk->sort_mode(ColumnID{2}), SortMode::AscendingNullsLast);
+  EXPECT_EQ(chunk->sort_mode(ColumnID{3}), std::nullopt);
+
+  // Sort modes are also detected for delta chunks and kept when segments are re-encoded.
+  auto delta_table = Table{2};
+  delta_table.add_column("a", "string", false);
+  delta_table.use_delta_store();
+  delta_table.append({"b"});
+  delta_table.append({"a"});
+  delta_table.merge_delta();
+  EXPECT_EQ(delta_table.get_chunk(ChunkID{0})->sort_mode(ColumnID{0}), SortMode::DescendingNullsLast);
+  delta_table.use_global_dictionary(ColumnID{0});
+  EXPECT_EQ(delta_table.get_chunk(ChunkID{0})->sort_mode(ColumnID{0}), SortMode::DescendingNullsLast);
+}
+
+TEST_F(StorageTableTest, Cluster) {
+  auto table = Table{3};
+  table.add_column("a", "int", true);
+  table.add_column("b", "string", false);
+  table.use_block_zone_maps(2);
+  table.use_bloom_filter(ColumnID{1});
+  table.append({3, "x"});
+  table.append({NULL_VALUE, "y"});
+  table.append({1, "b"});
+  table.compress_chunk(ChunkID{0}, {SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{}});
+  table.append({3, "a"});
+  table.append({1, "a"});
+  table.append({2, "c"});
+  table.append({1, "a"});
+
+  table.cluster({ColumnID{0}, ColumnID{1}},
+                {SegmentEncodingSpec{EncodingType::FrameOfReference}, SegmentEncodingSpec{EncodingType::LZ}});
+  EXPECT_EQ(table.row_count(), 7);
+  EXPECT_EQ(table.chunk_count(), 3);
+  EXPECT_EQ(table.get_chunk(ChunkID{2})->size(), 1);
+
+  const auto expected_a = std::vector<AllTypeVariant>{1, 1, 1, 2, 3, 3, NULL_VALUE};
+  const auto expected_b = std::vector<AllTypeVariant>{"a", "a", "b", "c", "a", "x", "y"};
+  for (auto row_id = size_t{0}; row_id < expected_a.size(); ++row_id) {
+    const auto chunk = table.get_chunk(ChunkID{static_cast<uint32_t>(row_id / 3)});
+    const auto chunk_offset = static_cast<ChunkOffset>(row_id % 3);
+    const auto a = (*chunk->get_segment(ColumnID{0}))[chunk_offset];
+    EXPECT_TRUE(variant_is_null(a) ? variant_is_null(expected_a[row_id]) : a == expected_a[row_id]);
+    EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[chunk_offset], expected_b[row_id]);
+  }
+
+  // All chunks are compressed and keep the table's zone maps and Bloom filters.
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    EXPECT_TRUE(chunk->sort_mode(ColumnID{0}));
+    EXPECT_EQ(chunk->get_zone_map(ColumnID{0})->block_size(), 2);
+    EXPECT_NE(chunk->get_bloom_filter(ColumnID{1}), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(chunk->get_segment(ColumnID{0})), nullptr);
+  }
+
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->sort_mode(ColumnID{0}), SortMode::AscendingNullsLast);
+  EXPECT_EQ(table.get_chunk(ChunkID{1})->sort_mode(ColumnID{0}), SortMode::AscendingNullsLast);
+
+  // New rows go into a new chunk.
+  table.append({0, "z"});
+  EXPECT_EQ(table.chunk_count(), 4);
+}
+
+TEST_F(StorageTableTest, Partitioning) {
+  auto table = Table{2};
+  table.add_column("tenant", "int", true);
+  table.add_column("b", "string", false);
+  EXPECT_EQ(table.partitioning(), nullptr);
+  EXPECT_EQ(table.partition_count(), 1);
+  table.partition_by_range(ColumnID{0}, {10, 20});
+  EXPECT_EQ(table.partition_count(), 3);
+
+  // Each partition appends to its own chunks.
+  table.append({15, "a"});
+  table.append({5, "b"});
+  table.append({NULL_VALUE, "c"});
+  table.append({12, "d"});
+  table.append({11, "e"});
+  EXPECT_EQ(table.row_count(), 5);
+  EXPECT_EQ(table.chunk_count(), 3);
+  EXPECT_EQ(table.partition_chunk_ids(PartitionID{0}), (std::vector<ChunkID>{ChunkID{0}}));
+  EXPECT_EQ(table.partition_chunk_ids(PartitionID{1}), (std::vector<ChunkID>{ChunkID{1}, ChunkID{2}}));
+  EXPECT_TRUE(table.partition_chunk_ids(PartitionID{2}).empty());
+  EXPECT_EQ(table.partition_id(ChunkID{2}), PartitionID{1});
+  EXPECT_EQ((*table.get_chunk(ChunkID{2})->get_segment(ColumnID{1}))[0], AllTypeVariant{"e"});
+
+  // Compressed chunks are not appended to anymore.
+  table.compress_chunk(ChunkID{0});
+  table.append({0, "f"});
+  EXPECT_EQ(table.partition_chunk_ids(PartitionID{0}), (std::vector<ChunkID>{ChunkID{0}, ChunkID{3}}));
+
+  // Clustering keeps the partitions.
+  table.cluster({ColumnID{1}});
+  EXPECT_EQ(table.row_count(), 6);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ(table.partitioning()->partition((*chunk->get_segment(ColumnID{0}))[chunk_offset]),
+                table.partition_id(chunk_id));
+    }
+  }
+
+  EXPECT_THROW(table.partition_by_hash(ColumnID{0}, PartitionID{2}), std::logic_error);
+}
+
+TEST_F(StorageTableTest, AppendColumns) {
+  const auto ints = std::vector<int32_t>{1, 2, 3, 4, 5};
+  const auto strings = std::vector<std::string>{"a", "", "c", "d", "e"};
+  const auto null_values = Bitmap{false, true, false, false, false};
+  const auto column_batches = std::vector<std::shared_ptr<const AbstractColumnBatch>>{
+      std::make_shared<ColumnBatch<int32_t>>(ints), std::make_shared<ColumnBatch<std::string>>(strings, &null_values)};
+
+  // The rows are split into chunks of the target size, starting with the free space of the last chunk.
+  table.append({0, "z"});
+  table.append_columns(column_batches);
+  EXPECT_EQ(table.row_count(), 6);
+  EXPECT_EQ(table.chunk_count(), 3);
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->size(), 2);
+  EXPECT_EQ((*table.get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[1], AllTypeVariant{1});
+  EXPECT_TRUE(variant_is_null((*table.get_chunk(ChunkID{1})->get_segment(ColumnID{1}))[0]));
+  EXPECT_EQ((*table.get_chunk(ChunkID{2})->get_segment(ColumnID{1}))[1], AllTypeVariant{"e"});
+  const auto& zone = static_cast<const ZoneMap<int32_t>&>(*table.get_chunk(ChunkID{2})->get_zone_map(ColumnID{0}));
+  EXPECT_EQ(zone.zone().min, 4);
+  EXPECT_EQ(zone.zone().max, 5);
+
+  // Delta stores and partitions are supported.
+  auto partitioned_table = Table{2};
+  partitioned_table.add_column("a", "int", false);
+  partitioned_table.add_column("b", "string", true);
+  partitioned_table.use_delta_store();
+  partitioned_table.partition_by_range(ColumnID{0}, {3});
+  partitioned_table.append_columns(column_batches);
+  EXPECT_EQ(partitioned_table.row_count(), 5);
+  EXPECT_EQ(partitioned_table.partition_chunk_ids(PartitionID{0}), (std::vector<ChunkID>{ChunkID{0}}));
+  EXPECT_EQ(partitioned_table.partition_chunk_ids(PartitionID{1}), (std::vector<ChunkID>{ChunkID{1}, ChunkID{2}}));
+  EXPECT_TRUE(std::dynamic_pointer_cast<UnsortedDictionarySegment<std::string>>(
+      partitioned_table.get_chunk(ChunkID{2})->get_segment(ColumnID{1})));
+  EXPECT_EQ((*partitioned_table.get_chunk(ChunkID{2})->get_segment(ColumnID{0}))[0], AllTypeVariant{5});
+
+  // The batches have to match the columns' types and nullability.
+  const auto longs = std::vector<int64_t>{1, 2, 3, 4, 5};
+  EXPECT_THROW(table.append_columns({std::make_shared<ColumnBatch<int64_t>>(longs), column_batches[1]}),
+               std::logic_error);
+  EXPECT_THROW(table.append_columns({column_batches[1], column_batches[0]}), std::logic_error);
+  EXPECT_THROW(table.append_columns({column_batches[0]}), std::logic_error);
+  EXPECT_THROW(
+      table.append_columns({std::make_shared<ColumnBatch<int32_t>>(std::span{ints}.first(2)), column_batches[1]}),
+      std::logic_error);
+  EXPECT_THROW(partitioned_table.append_columns({std::make_shared<ColumnBatch<int32_t>>(ints, &null_values),
+                                                 column_batches[1]}),
+               std::logic_error);
+  EXPECT_EQ(table.row_count(), 6);
+}
+
+TEST_F(StorageTableTest, RebalanceChunks) {
+  const auto chunk_sizes = [](const Table& table) {
+    auto sizes = std::vector<ChunkOffset>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      sizes.emplace_back(table.get_chunk(chunk_id)->size());
+    }
+    return sizes;
+  };
+
+  // Too large chunks are split.
+  auto table = Table{10};
+  table.add_column("a", "int", true);
+  table.add_column("b", "string", false);
+  for (auto value = int32_t{0}; value < 28; ++value) {
+    table.append({value % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value}, std::to_string(value)});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    table.compress_chunk(chunk_id);
+  }
+  table.rebalance_chunks(2, 4, SegmentEncodingSpec{EncodingType::RunLength});
+  // The rows are moved to new chunks. The old chunks are emptied, as no transaction can see them anymore.
+  EXPECT_EQ(chunk_sizes(table), (std::vector<ChunkOffset>{0, 0, 0, 4, 4, 4, 4, 4, 4, 4}));
+  EXPECT_EQ(table.row_count(), 28);
+  EXPECT_EQ(table.approx_valid_row_count(), 28);
+  EXPECT_EQ(table.target_chunk_size(), 10);
+
+  auto row_index = int32_t{0};
+  for (auto chunk_id = ChunkID{3}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    EXPECT_NE(std::dynamic_pointer_cast<RunLengthSegment<std::string>>(chunk->get_segment(ColumnID{1})), nullptr);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset, ++row_index) {
+      EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{std::to_string(row_index)});
+      EXPECT_EQ(variant_is_null((*chunk->get_segment(ColumnID{0}))[chunk_offset]), row_index % 7 == 0);
+    }
+  }
+  EXPECT_EQ(row_index, 28);
+
+  // Appended rows go into a new mutable chunk.
+  table.append({28, "28"});
+  EXPECT_EQ(table.chunk_count(), 11);
+  EXPECT_EQ(table.get_chunk(ChunkID{10})->size(), 1);
+
+  // Chunks that are not out of band keep their ids.
+  // Too small chunks are merged with each other or with a neighbour.
+  auto small_chunk_table = Table{4};
+  small_chunk_table.add_column("a", "int", false);
+  for (const auto chunk_size : {4, 1, 4, 1, 1}) {
+    for (auto index = 0; index < chunk_size; ++index) {
+      small_chunk_table.append({index});
+    }
+    small_chunk_table.compress_chunk(static_cast<ChunkID>(small_chunk_table.chunk_count() - 1));
+  }
+  small_chunk_table.rebalance_chunks(2, 4);
+  // The second group is moved into the first chunk, which was emptied after the first group had been rewritten.
+  EXPECT_EQ(chunk_sizes(small_chunk_table), (std::vector<ChunkOffset>{2, 0, 4, 0, 0, 3, 2}));
+
+  // Groups with rows held by transactions are skipped.
+  auto& transaction_manager = TransactionManager::get();
+  const auto deleter = transaction_manager.new_transaction_context();
+  ASSERT_TRUE(deleter->try_delete(small_chunk_table.get_chunk(ChunkID{2})->mvcc_data(), 0));
+  small_chunk_table.rebalance_chunks(1, 3);
+  EXPECT_EQ(chunk_sizes(small_chunk_table), (std::vector<ChunkOffset>{2, 0, 4, 0, 0, 3, 2}));
+  deleter->rollback();
+
+  // Running transactions still see the rows in the old chunks, which are thus kept.
+  const auto reader = transaction_manager.new_transaction_context();
+  small_chunk_table.rebalance_chunks(1, 3);
+  EXPECT_EQ(chunk_sizes(small_chunk_table), (std::vector<ChunkOffset>{2, 2, 4, 2, 0, 3, 2}));
+  EXPECT_TRUE(reader->is_visible(*small_chunk_table.get_chunk(ChunkID{2})->mvcc_data(), 0));
+  EXPECT_FALSE(reader->is_visible(*small_chunk_table.get_chunk(ChunkID{1})->mvcc_data(), 0));
+  EXPECT_EQ(small_chunk_table.approx_valid_row_count(), 11);
+
+  EXPECT_THROW(small_chunk_table.rebalance_chunks(3, 4), std::logic_error);
+}
+
 }  // namespace opossum
@@ -0,0 +1,98 @@
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "storage/partitioning.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/table_writer.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageTableWriterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table.add_column("a", "int", false);
+    table.add_column("b", "string", true);
+  }
+
+  Table table{3};
+};
+
+TEST_F(StorageTableWriterTest, SealsFullChunks) {
+  {
+    auto writer = TableWriter{table};
+    for (auto value = int32_t{0}; value < 7; ++value) {
+      writer.append({value, value % 2 == 0 ? AllTypeVariant{std::to_string(value)} : NULL_VALUE});
+    }
+
+    // Full chunks are published right away, the last row only when the writer is flushed.
+    EXPECT_EQ(table.row_count(), 6);
+    EXPECT_EQ(table.chunk_count(), 3);
+  }
+  EXPECT_EQ(table.row_count(), 7);
+  EXPECT_EQ(table.chunk_count(), 4);
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->size(), 0);
+  EXPECT_EQ((*table.get_chunk(ChunkID{2})->get_segment(ColumnID{0}))[1], AllTypeVariant{4});
+  EXPECT_EQ(table.get_chunk(ChunkID{3})->size(), 1);
+
+  // Sealed chunks are not appended to.
+  table.append({7, "7"});
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->size(), 1);
+  EXPECT_EQ(table.get_chunk(ChunkID{3})->size(), 1);
+  table.compress_chunk(ChunkID{1});
+  EXPECT_EQ(table.row_count(), 8);
+}
+
+TEST_F(StorageTableWriterTest, ConcurrentWriters) {
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto ROWS_PER_THREAD = 1000;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < THREAD_COUNT; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      auto writer = TableWriter{table};
+      for (auto row_index = 0; row_index < ROWS_PER_THREAD; ++row_index) {
+        writer.append({thread_index, std::to_string(row_index)});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(table.row_count(), THREAD_COUNT * ROWS_PER_THREAD);
+  auto row_counts = std::vector<int32_t>(THREAD_COUNT);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto segment =
+        std::dynamic_pointer_cast<ValueSegment<int32_t>>(table.get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    ASSERT_NE(segment, nullptr);
+    for (const auto value : segment->values()) {
+      ++row_counts[value];
+    }
+  }
+  EXPECT_EQ(row_counts, std::vector<int32_t>(THREAD_COUNT, ROWS_PER_THREAD));
+}
+
+TEST_F(StorageTableWriterTest, PartitionedTableWithDeltaStore) {
+  auto delta_table = Table{2};
+  delta_table.add_column("a", "int", false);
+  delta_table.use_delta_store(SegmentEncodingSpec{EncodingType::RunLength});
+  delta_table.partition_by_range(ColumnID{0}, {10});
+
+  auto writer = TableWriter{delta_table};
+  for (const auto value : {1, 11, 2, 12}) {
+    writer.append({value});
+  }
+
+  // Each partition has its own chunk, which is merged into the main when it is sealed.
+  ASSERT_EQ(delta_table.chunk_count(), 3);
+  for (auto chunk_id = ChunkID{1}; chunk_id < 3; ++chunk_id) {
+    const auto segment = delta_table.get_chunk(chunk_id)->get_segment(ColumnID{0});
+    EXPECT_NE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(segment), nullptr);
+    EXPECT_EQ(delta_table.partition_id(chunk_id), delta_table.partitioning()->partition((*segment)[0]));
+  }
+  EXPECT_EQ(delta_table.partition_chunk_ids(PartitionID{1}).size(), 1);
+}
+
+}  // namespace opossum
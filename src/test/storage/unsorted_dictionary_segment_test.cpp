@@ -0,0 +1,86 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/unsorted_dictionary_segment.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageUnsortedDictionarySegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<UnsortedDictionarySegment<int32_t>> segment_int{
+      std::make_shared<UnsortedDictionarySegment<int32_t>>()};
+  std::shared_ptr<UnsortedDictionarySegment<std::string>> segment_str{
+      std::make_shared<UnsortedDictionarySegment<std::string>>(true)};
+};
+
+TEST_F(StorageUnsortedDictionarySegmentTest, AppendAndAccess) {
+  segment_str->append("Steve");
+  segment_str->append("Bill");
+  segment_str->append(NULL_VALUE);
+  segment_str->append("Steve");
+  segment_str->append(3);
+
+  EXPECT_EQ(segment_str->size(), 5);
+  EXPECT_EQ(segment_str->unique_values_count(), 3);
+  // Values keep the ValueID of their first occurrence.
+  const auto value_ids = segment_str->value_ids();
+  EXPECT_EQ(std::vector(value_ids.begin(), value_ids.end()),
+            (std::vector<ValueID>{ValueID{0}, ValueID{1}, INVALID_VALUE_ID, ValueID{0}, ValueID{2}}));
+  EXPECT_EQ(segment_str->dictionary()[1], "Bill");
+  EXPECT_EQ(segment_str->value_of_value_id(ValueID{2}), "3");
+
+  EXPECT_EQ(segment_str->get(3), "Steve");
+  EXPECT_EQ(segment_str->get_typed_value(2), std::nullopt);
+  EXPECT_TRUE(variant_is_null((*segment_str)[2]));
+  EXPECT_EQ((*segment_str)[1], AllTypeVariant{"Bill"});
+  EXPECT_THROW(segment_str->get(2), std::logic_error);
+  EXPECT_THROW(segment_str->get(5), std::logic_error);
+
+  EXPECT_THROW(segment_int->append(NULL_VALUE), std::logic_error);
+  EXPECT_THROW(segment_int->append("Hello"), std::logic_error);
+}
+
+TEST_F(StorageUnsortedDictionarySegmentTest, Materialize) {
+  segment_str->append("Steve");
+  segment_str->append(NULL_VALUE);
+  segment_str->append("Bill");
+
+  const auto value_segment = segment_str->materialize();
+  EXPECT_EQ(value_segment->size(), 3);
+  EXPECT_EQ(value_segment->get(0), "Steve");
+  EXPECT_TRUE(value_segment->is_null(1));
+  EXPECT_EQ(value_segment->get(2), "Bill");
+}
+
+TEST_F(StorageUnsortedDictionarySegmentTest, CompressToDictionarySegment) {
+  for (const auto value : {5, 3, 5, 9, 3, 1}) {
+    segment_int->append(value);
+  }
+
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(segment_int);
+  EXPECT_EQ(dictionary_segment->dictionary(), (std::vector<int32_t>{1, 3, 5, 9}));
+  EXPECT_EQ(dictionary_segment->size(), 6);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_int->size(); ++chunk_offset) {
+    EXPECT_EQ(dictionary_segment->get(chunk_offset), segment_int->get(chunk_offset));
+  }
+
+  segment_str->append("Steve");
+  segment_str->append(NULL_VALUE);
+  segment_str->append("Bill");
+  const auto dictionary_segment_str = std::make_shared<DictionarySegment<std::string>>(segment_str);
+  EXPECT_EQ(dictionary_segment_str->get(0), "Steve");
+  EXPECT_EQ(dictionary_segment_str->get(2), "Bill");
+  EXPECT_EQ(dictionary_segment_str->attribute_vector()->get(1), dictionary_segment_str->null_value_id());
+}
+
+TEST_F(StorageUnsortedDictionarySegmentTest, MemoryUsage) {
+  segment_int->append(1);
+  segment_int->append(2);
+  segment_int->append(1);
+
+  // 3 ValueIDs with 4 bytes each and 2 distinct values with 4 bytes each.
+  EXPECT_EQ(segment_int->estimate_memory_usage(), 3 * 4 + 2 * 4);
+}
+
+}  // namespace opossum
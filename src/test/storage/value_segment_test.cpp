@@ -55,6 +55,26 @@ TEST_F(StorageValueSegmentTest, MemoryUsage) {
   EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{4});
   int_value_segment.append(2);
   EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{8});
+
+  // Short strings are inlined, long strings are copied into the segment's arena.
+  string_value_segment.append("Hello");
+  EXPECT_EQ(string_value_segment.estimate_memory_usage(), size_t{16});
+  string_value_segment.append("Hello wonderful world!");
+  EXPECT_EQ(string_value_segment.estimate_memory_usage(), size_t{2 * 16 + 1024});
+}
+
+TEST_F(StorageValueSegmentTest, StringValues) {
+  string_value_segment.append("Hello");
+  string_value_segment.append("Hello wonderful world!");
+  string_value_segment.append(3);
+
+  const auto& values = string_value_segment.values();
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_TRUE(values[0].is_inlined());
+  EXPECT_FALSE(values[1].is_inlined());
+  EXPECT_EQ(values[1], "Hello wonderful world!");
+  EXPECT_EQ(string_value_segment.get(1), "Hello wonderful world!");
+  EXPECT_EQ(string_value_segment[2], AllTypeVariant{"3"});
 }
 
 TEST_F(StorageValueSegmentTest, NullValueHandling) {
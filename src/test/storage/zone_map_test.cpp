@@ -0,0 +1,78 @@
+#include "base_test.hpp"
+
+#include "storage/zone_map.hpp"
+
+namespace opossum {
+
+class StorageZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {5, 3, 9, 7}) {
+      zone_map.append(value);
+    }
+    zone_map.append(std::nullopt);
+  }
+
+  ZoneMap<int32_t> zone_map{2};
+};
+
+TEST_F(StorageZoneMapTest, Statistics) {
+  const auto& zone = zone_map.zone();
+  EXPECT_EQ(zone.min, 3);
+  EXPECT_EQ(zone.max, 9);
+  EXPECT_EQ(zone.row_count, 5);
+  EXPECT_EQ(zone.null_count, 1);
+
+  EXPECT_EQ(zone_map.block_size(), 2);
+  const auto& block_zones = zone_map.block_zones();
+  ASSERT_EQ(block_zones.size(), 3);
+  EXPECT_EQ(block_zones[0].min, 3);
+  EXPECT_EQ(block_zones[0].max, 5);
+  EXPECT_EQ(block_zones[1].min, 7);
+  EXPECT_EQ(block_zones[1].max, 9);
+  EXPECT_EQ(block_zones[2].row_count, 1);
+  EXPECT_EQ(block_zones[2].null_count, 1);
+}
+
+TEST_F(StorageZoneMapTest, NoBlockZones) {
+  auto string_zone_map = ZoneMap<std::string>{};
+  string_zone_map.append("b");
+  string_zone_map.append("a");
+  EXPECT_EQ(string_zone_map.zone().min, "a");
+  EXPECT_EQ(string_zone_map.zone().max, "b");
+  EXPECT_EQ(string_zone_map.block_size(), 0);
+  EXPECT_TRUE(string_zone_map.block_zones().empty());
+}
+
+TEST_F(StorageZoneMapTest, Match) {
+  // The segment contains a NULL value, so that the predicate never holds for all rows.
+  EXPECT_EQ(zone_map.match(ScanType::OpEquals, 2), ZoneMatch::None);
+  EXPECT_EQ(zone_map.match(ScanType::OpEquals, 4), ZoneMatch::Some);
+  EXPECT_EQ(zone_map.match(ScanType::OpLessThan, 3), ZoneMatch::None);
+  EXPECT_EQ(zone_map.match(ScanType::OpLessThanEquals, 3), ZoneMatch::Some);
+  EXPECT_EQ(zone_map.match(ScanType::OpGreaterThan, 9), ZoneMatch::None);
+  EXPECT_EQ(zone_map.match(ScanType::OpGreaterThanEquals, 10), ZoneMatch::None);
+  EXPECT_EQ(zone_map.match(ScanType::OpNotEquals, 10), ZoneMatch::Some);
+  EXPECT_EQ(zone_map.match(ScanType::OpEquals, NULL_VALUE), ZoneMatch::None);
+
+  const auto& block_zone = zone_map.block_zones()[0];
+  EXPECT_EQ(ZoneMap<int32_t>::match(block_zone, ScanType::OpEquals, 4), ZoneMatch::Some);
+  EXPECT_EQ(ZoneMap<int32_t>::match(block_zone, ScanType::OpNotEquals, 6), ZoneMatch::All);
+  EXPECT_EQ(ZoneMap<int32_t>::match(block_zone, ScanType::OpLessThan, 6), ZoneMatch::All);
+  EXPECT_EQ(ZoneMap<int32_t>::match(block_zone, ScanType::OpLessThan, 5), ZoneMatch::Some);
+  EXPECT_EQ(ZoneMap<int32_t>::match(block_zone, ScanType::OpLessThanEquals, 5), ZoneMatch::All);
+  EXPECT_EQ(ZoneMap<int32_t>::match(block_zone, ScanType::OpGreaterThan, 2), ZoneMatch::All);
+  EXPECT_EQ(ZoneMap<int32_t>::match(block_zone, ScanType::OpGreaterThanEquals, 3), ZoneMatch::All);
+  EXPECT_EQ(ZoneMap<int32_t>::match(block_zone, ScanType::OpGreaterThanEquals, 4), ZoneMatch::Some);
+
+  // Blocks that only contain NULL values never match.
+  EXPECT_EQ(ZoneMap<int32_t>::match(zone_map.block_zones()[2], ScanType::OpNotEquals, 4), ZoneMatch::None);
+
+  auto constant_zone_map = ZoneMap<int32_t>{};
+  constant_zone_map.append(4);
+  constant_zone_map.append(4);
+  EXPECT_EQ(constant_zone_map.match(ScanType::OpEquals, 4), ZoneMatch::All);
+  EXPECT_EQ(constant_zone_map.match(ScanType::OpNotEquals, 4), ZoneMatch::None);
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#include "base_test.hpp"
+
+#include "utils/lz_compression.hpp"
+
+namespace opossum {
+
+class LZCompressionTest : public BaseTest {
+ protected:
+  static std::vector<char> roundtrip(const std::string& input) {
+    const auto compressed = lz_compress(input);
+    auto output = std::vector<char>(input.size());
+    lz_decompress(compressed, output);
+    return output;
+  }
+};
+
+TEST_F(LZCompressionTest, Roundtrip) {
+  const auto inputs = std::vector<std::string>{
+      "", "a", "short", "abcabcabcabcabcabcabcabcabcabcabcabc", std::string(100'000, 'x'),
+      "the quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy cat"};
+
+  for (const auto& input : inputs) {
+    const auto output = roundtrip(input);
+    EXPECT_EQ(std::string(output.begin(), output.end()), input);
+  }
+}
+
+TEST_F(LZCompressionTest, RoundtripPseudoRandomData) {
+  auto input = std::string{};
+  auto state = uint32_t{42};
+  for (auto index = 0; index < 200'000; ++index) {
+    state = state * 1664525u + 1013904223u;
+    // Small alphabet so that there are matches of varying lengths and offsets.
+    input.push_back(static_cast<char>('a' + (state >> 28)));
+  }
+
+  const auto output = roundtrip(input);
+  EXPECT_EQ(std::string(output.begin(), output.end()), input);
+}
+
+TEST_F(LZCompressionTest, CompressesRepetitiveData) {
+  const auto input = std::string(100'000, 'x');
+  EXPECT_LT(lz_compress(input).size(), 1'000);
+}
+
+TEST_F(LZCompressionTest, DetectsWrongOutputSize) {
+  const auto input = std::string{"abcabcabcabcabcabcabcabcabcabcabcabc"};
+  const auto compressed = lz_compress(input);
+
+  auto too_small_output = std::vector<char>(input.size() - 1);
+  EXPECT_THROW(lz_decompress(compressed, too_small_output), std::logic_error);
+  auto too_big_output = std::vector<char>(input.size() + 1);
+  EXPECT_THROW(lz_decompress(compressed, too_big_output), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#include "base_test.hpp"
+
+#include <atomic>
+
+#include "utils/periodic_task.hpp"
+
+namespace opossum {
+
+class PeriodicTaskTest : public BaseTest {};
+
+TEST_F(PeriodicTaskTest, RunNow) {
+  auto run_count = uint32_t{0};
+  auto periodic_task = PeriodicTask(std::chrono::hours{1}, [&]() { ++run_count; });
+  periodic_task.run_now();
+  periodic_task.run_now();
+  EXPECT_EQ(run_count, 2);
+}
+
+TEST_F(PeriodicTaskTest, RunsInBackgroundUntilDestroyed) {
+  auto run_count = std::atomic<uint32_t>{0};
+  {
+    auto periodic_task = PeriodicTask(std::chrono::milliseconds{1}, [&]() { ++run_count; });
+    for (auto attempt = 0; attempt < 1'000 && run_count < 3; ++attempt) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+    ASSERT_GE(run_count, 3);
+  }
+
+  // The background thread is stopped once the task is destroyed.
+  const auto final_run_count = run_count.load();
+  std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  EXPECT_EQ(run_count, final_run_count);
+}
+
+}  // namespace opossum